@@ -0,0 +1,103 @@
+//	exMemory bench | exSignature::Find vs a byte by byte scan over a 100 MB synthetic code image
+//	build: g++ -std=c++20 -O2 -Ilibs bench/scan_bench.cpp -o scan_bench | cl /std:c++20 /O2 /EHsc /Ilibs bench\scan_bench.cpp
+
+#include <Memory/exScan.hpp>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+//	reference scan , one offset at a time with the whole pattern compared at each , -1 is a wildcard
+static size_t FindNaive(const std::vector<int>& pattern, const unsigned char* data, const size_t& size)
+{
+	for (size_t i = 0; i + pattern.size() <= size; i++)
+	{
+		size_t j{ 0 };
+		while (j < pattern.size() && (pattern[j] == -1 || data[i + j] == pattern[j]))
+			j++;
+
+		if (j == pattern.size())
+			return i;
+	}
+
+	return exSignature::npos;
+}
+
+//	parses the same ida style signature as exSignature
+static std::vector<int> ParsePattern(const char* signature)
+{
+	std::vector<int> result;
+	while (*signature)
+	{
+		if (*signature == ' ')
+			signature++;
+		else if (*signature == '?')
+		{
+			signature += signature[1] == '?' ? 2 : 1;
+			result.push_back(-1);
+		}
+		else
+		{
+			char* end{ nullptr };
+			result.push_back(int(strtoul(signature, &end, 16)));
+			signature = end;
+		}
+	}
+
+	return result;
+}
+
+int main()
+{
+	constexpr size_t szImage = 100u << 20;								//	about the size of the game's .text section
+	constexpr int mPasses = 5;
+	const char* signatures[] = {
+		"48 8B 05 ? ? ? ? 48 85 C0 74 ? 48 8B 5C 24 ? 48 83 C4 ? 5F C3",	//	rip relative global load , as used for GWorld
+		"E8 ? ? ? ? 48 8B D8 48 85 C0",										//	call & null check , common bytes only
+		"0F B6 ? ? ? 84 C0",												//	short , starts with a common byte
+	};
+
+	//	half the bytes are drawn from the most common opcode & modrm bytes so the anchors see realistic candidate rates
+	std::mt19937 rng(1);
+	const unsigned char common[] = { 0x48, 0x8B, 0x89, 0x00, 0xCC, 0xE8, 0x24, 0x4C, 0x0F, 0xFF };
+	std::vector<unsigned char> image(szImage);
+	for (unsigned char& value : image)
+		value = rng() % 2 ? common[rng() % sizeof(common)] : static_cast<unsigned char>(rng());
+
+	size_t bad{ 0 };
+	for (const char* signature : signatures)
+	{
+		const exSignature sig(signature);
+		const std::vector<int> pattern = ParsePattern(signature);
+
+		//	plant the only guaranteed match near the end so both scans cover the whole image
+		const size_t planted = szImage - 0x100;
+		for (size_t i = 0; i < pattern.size(); i++)
+			image[planted + i] = pattern[i] == -1 ? 0x11 : static_cast<unsigned char>(pattern[i]);
+
+		const size_t expected = FindNaive(pattern, image.data(), image.size());
+
+		const auto naiveStart = std::chrono::steady_clock::now();
+		size_t naive{ 0 };
+		for (int pass = 0; pass < mPasses; pass++)
+			naive = FindNaive(pattern, image.data(), image.size());
+		const auto naiveEnd = std::chrono::steady_clock::now();
+
+		size_t found{ 0 };
+		for (int pass = 0; pass < mPasses; pass++)
+			found = sig.Find(image.data(), image.size());
+		const auto findEnd = std::chrono::steady_clock::now();
+
+		bad += found != expected || naive != expected;
+
+		const double naiveMs = std::chrono::duration<double, std::milli>(naiveEnd - naiveStart).count() / mPasses;
+		const double findMs = std::chrono::duration<double, std::milli>(findEnd - naiveEnd).count() / mPasses;
+		printf("%-66s naive %8.2f ms | exSignature %7.2f ms ( %6.0f MB/s , %5.1fx ) | match %s\n", signature, naiveMs, findMs,
+			double(szImage >> 20) / (findMs / 1000.0), naiveMs / findMs, found == expected ? "ok" : "WRONG");
+
+		//	restore the random bytes for the next signature
+		for (size_t i = 0; i < pattern.size(); i++)
+			image[planted + i] = static_cast<unsigned char>(rng());
+	}
+
+	return bad ? 1 : 0;
+}
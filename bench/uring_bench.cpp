@@ -0,0 +1,94 @@
+//	exMemory bench | io_uring vs process_vm_readv batches against a local stand-in process
+//	linux only , build: g++ -std=c++20 -O2 -Ilibs bench/uring_bench.cpp -o uring_bench
+
+#include <Memory/exBackend.hpp>
+#include <chrono>
+#include <cstdio>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#if !defined(EXMEMORY_IO_URING)
+int main() { printf("io_uring headers are not available\n"); return 0; }
+#else
+
+static char data[64 << 20];											//	copied into the forked stand-in
+
+int main()
+{
+	constexpr size_t mReads = 20000;									//	requests per batch , about one actor walk of reads
+	constexpr size_t szRead = 0x630;									//	sizeof(ACharacter)
+	constexpr size_t mStride = 3001;									//	spacing of the requests in data
+	constexpr int mPasses = 10;
+
+	for (size_t i = 0; i < sizeof(data); i++)
+		data[i] = char(i * 7);
+
+	//	one unmapped page & one read straddling into it , both must fail & be zeroed
+	char* unmapped = static_cast<char*>(mmap(nullptr, 0x2000, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+	munmap(unmapped + 0x1000, 0x1000);
+
+	//	the stand-in is a fork , so every address of this process is valid in it
+	const pid_t pid = fork();
+	if (!pid)
+	{
+		pause();
+		_exit(0);
+	}
+
+	std::vector<char> out(mReads * szRead);
+	std::vector<readRequest_t> requests;
+	for (size_t i = 0; i < mReads; i++)
+		requests.push_back({ i64_t(data + i * mStride), out.data() + i * szRead, szRead });
+
+	requests[5].addr = i64_t(unmapped + 0x1000);
+	requests[2000].addr = i64_t(unmapped + 0x1000 - 6);
+
+	auto run = [&](exMemoryBackend& backend, const char* name)
+		{
+			size_t count{ 0 };
+			const auto batchStart = std::chrono::steady_clock::now();
+			for (int pass = 0; pass < mPasses; pass++)
+				count = backend.ReadMemoryBatch(requests.data(), requests.size());
+			const auto batchEnd = std::chrono::steady_clock::now();
+
+			size_t bad{ 0 };
+			for (size_t i = 0; i < mReads; i++)
+			{
+				const char* result = out.data() + i * szRead;
+				const bool bExpected = i != 5 && i != 2000;
+				if (requests[i].bSuccess != bExpected)
+					bad++;
+				else if (bExpected ? memcmp(result, data + i * mStride, szRead) != 0 : std::any_of(result, result + szRead, [](char c) { return c != 0; }))
+					bad++;
+			}
+
+			const auto singleStart = std::chrono::steady_clock::now();
+			for (int pass = 0; pass < mPasses; pass++)
+			{
+				for (readRequest_t& request : requests)
+					backend.ReadMemory(request.addr, request.buffer, request.szRead);
+			}
+			const auto singleEnd = std::chrono::steady_clock::now();
+
+			printf("%-18s batch %8.2f ms | single reads %8.2f ms | read %zu / %zu , %zu wrong\n", name,
+				std::chrono::duration<double, std::milli>(batchEnd - batchStart).count() / mPasses,
+				std::chrono::duration<double, std::milli>(singleEnd - singleStart).count() / mPasses,
+				count, mReads, bad);
+		};
+
+	exLinuxBackend iovec(pid);
+	run(iovec, "process_vm_readv");
+
+	exUringBackend uring(pid);
+	if (uring.IsRingValid())
+		run(uring, "io_uring");
+	else
+		printf("io_uring ring could not be created\n");
+
+	kill(pid, SIGKILL);
+	waitpid(pid, nullptr, 0);
+
+	return 0;
+}
+
+#endif
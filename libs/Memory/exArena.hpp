@@ -0,0 +1,130 @@
+//	exMemory read arena | per generation buffer that remote views point into
+
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+*	bump allocator reset once per read generation , blocks are kept between generations so steady state costs no allocation
+*	memory handed out stays at the same address until the next reset
+*/
+class exReadArena
+{
+public:
+	static constexpr size_t			szBlock = 0x10000;					//	default block size , larger requests get their own block
+
+public:
+
+	/* returns zeroed storage for size bytes aligned to align , valid until Reset */
+	inline void* Allocate(const size_t& size, const size_t& align);
+
+	/* releases everything allocated since the last reset */
+	inline void Reset();
+
+	/* returns the bytes handed out since the last reset */
+	inline size_t GetUsed();
+
+	/* returns the bytes held by the arena */
+	inline size_t GetCapacity();
+
+private:
+	struct SBlock
+	{
+		std::unique_ptr<unsigned char[]>	data;						//	storage
+		size_t						size{ 0 };							//	bytes in the block
+	};
+
+private:
+	std::mutex						mMutex;
+	std::vector<SBlock>				vmBlocks;							//	blocks in use order
+	size_t							mBlock{ 0 };						//	block being filled
+	size_t							mOffset{ 0 };						//	first free byte in the block
+	size_t							mUsed{ 0 };							//	bytes handed out
+};
+
+/*
+*	read only view of a remote structure , points into the read cache page it lies in or into a copy in the read arena
+*	valid & unchanged until the next exMemory::NextGeneration , compare GetGeneration with exMemory::GetGeneration when a view is kept around
+*/
+template<typename T>
+class exRemoteView
+{
+	static_assert(std::is_trivially_copyable_v<T>, "remote views need trivially copyable types");
+
+public:
+	inline exRemoteView() = default;
+	inline exRemoteView(const T* data, const unsigned long long& generation) : pData(data), mGeneration(generation) {}
+
+public:
+	inline const T* get() const { return pData; }
+	inline const T& operator*() const { return *pData; }
+	inline const T* operator->() const { return pData; }
+	inline explicit operator bool() const { return pData != nullptr; }
+
+	/* returns the generation the view was read in */
+	inline const unsigned long long& GetGeneration() const { return mGeneration; }
+
+private:
+	const T*						pData{ nullptr };					//	arena copy , nullptr if the read failed
+	unsigned long long				mGeneration{ 0 };					//	generation of the read
+};
+
+void* exReadArena::Allocate(const size_t& size, const size_t& align)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	//	first block from the current one with room for the aligned request
+	for (; mBlock < vmBlocks.size(); mBlock++, mOffset = 0)
+	{
+		SBlock& block = vmBlocks[mBlock];
+		const size_t offset = (mOffset + align - 1) & ~(align - 1);
+		if (offset + size <= block.size)
+		{
+			mOffset = offset + size;
+			mUsed += size;
+			memset(block.data.get() + offset, 0, size);
+			return block.data.get() + offset;
+		}
+	}
+
+	//	new block , new[] storage is aligned for any fundamental type
+	SBlock block;
+	block.size = std::max(size, szBlock);
+	block.data = std::make_unique<unsigned char[]>(block.size);
+	vmBlocks.push_back(std::move(block));
+	mBlock = vmBlocks.size() - 1;
+	mOffset = size;
+	mUsed += size;
+
+	return vmBlocks.back().data.get();
+}
+
+void exReadArena::Reset()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mBlock = 0;
+	mOffset = 0;
+	mUsed = 0;
+}
+
+size_t exReadArena::GetUsed()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mUsed;
+}
+
+size_t exReadArena::GetCapacity()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	size_t result{ 0 };
+	for (const SBlock& block : vmBlocks)
+		result += block.size;
+
+	return result;
+}
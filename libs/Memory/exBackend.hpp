@@ -0,0 +1,1049 @@
+//	exMemory backends | raw memory i/o for a target process
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <limits.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <string>
+#if __has_include(<linux/io_uring.h>)
+#include <atomic>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#define EXMEMORY_IO_URING 1
+#endif
+#endif
+#include "exPlatform.hpp"
+
+//	architecture type helpers
+#if defined(_WIN64)
+typedef unsigned __int64  i64_t;
+#elif defined(_WIN32)
+typedef unsigned int i64_t;
+#else
+typedef uintptr_t i64_t;
+#endif
+
+//	scatter read request
+typedef struct READREQUEST64
+{
+	i64_t							addr{ 0 };							//	address to read in the target process
+	void*							buffer{ nullptr };					//	destination buffer
+	size_t							szRead{ 0 };						//	number of bytes to read
+	bool							bSuccess{ false };					//	set when all bytes were read
+} READREQUEST32, readRequest_t;
+
+//	gather write request
+typedef struct WRITEREQUEST64
+{
+	i64_t							addr{ 0 };							//	address to write in the target process
+	const void*						buffer{ nullptr };					//	source buffer
+	size_t							szWrite{ 0 };						//	number of bytes to write
+	bool							bSuccess{ false };					//	set when all bytes were written
+} WRITEREQUEST32, writeRequest_t;
+
+//	address range in the target process
+typedef struct MEMREGION64
+{
+	i64_t							base{ 0 };							//	first address of the region
+	size_t							size{ 0 };							//	size in bytes
+	bool							bReadable{ false };					//	committed & readable
+} MEMREGION32, memRegion_t;
+
+/*
+*	interface for reading & writing memory in a target process
+*	exMemory routes all instance memory operations through a backend
+*/
+class exMemoryBackend
+{
+public:
+	virtual ~exMemoryBackend() = default;
+
+	/* reads memory at the specified address into a buffer
+	* returns true if all bytes were read
+	*/
+	virtual bool ReadMemory(const i64_t& addr, void* buffer, const size_t& szRead) = 0;
+
+	/* writes a buffer to the specified address
+	* returns true if all bytes were written
+	*/
+	virtual bool WriteMemory(const i64_t& addr, const void* buffer, const size_t& szWrite) = 0;
+
+	/* reads a list of requests as a single submission
+	* the destination of a failed request is zeroed. returns the number of requests that were read completely
+	*/
+	virtual inline size_t ReadMemoryBatch(readRequest_t* requests, const size_t& count);
+
+	/* reads as much of a range as possible , unreadable pages are zeroed & skipped instead of failing the whole read
+	* pageMask ( optional ) receives one entry per page touched by the range , true if that part of the page was read
+	* returns the number of bytes copied
+	*/
+	virtual inline size_t ReadMemoryPartial(const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask = nullptr);
+
+	/* writes a list of requests as a single submission
+	* returns the number of requests that were written completely
+	*/
+	virtual inline size_t WriteMemoryBatch(writeRequest_t* requests, const size_t& count);
+
+	/* returns the region containing the address , unmapped ranges are returned as unreadable regions
+	* returns false if the address could not be queried
+	*/
+	virtual inline bool QueryRegion(const i64_t& addr, memRegion_t& region) { return false; }
+
+	/* returns every readable region of the target process sorted by address
+	* returns false if the regions could not be queried
+	*/
+	virtual inline bool QueryRegions(std::vector<memRegion_t>& regions) { return false; }
+
+	/* returns false once the target process has exited
+	* meant to be called every tick , backends answer from the handle they hold without enumerating processes
+	*/
+	virtual inline bool IsAlive() { return true; }
+
+	/* starts a new read generation , backends drop state they keep for one generation , see exMemory::NextGeneration */
+	virtual inline void NextGeneration() {}
+
+public:
+	static constexpr size_t			szPage = 0x1000;					//	granularity of partial reads
+
+	/* returns the number of pages touched by a range */
+	static constexpr size_t GetPageCount(const i64_t& addr, const size_t& size) { return size ? size_t(((addr + size - 1) / szPage) - (addr / szPage) + 1) : 0; }
+
+	/* returns the number of read syscalls issued by backends on the calling thread , see exReadMetrics */
+	static inline unsigned long long& SyscallCount() { static thread_local unsigned long long count{ 0 }; return count; }
+
+public:
+
+	/* template read memory
+	* NOTE: does not work with strings
+	*/
+	template<typename T>
+	auto Read(const i64_t& addr) noexcept -> T
+	{
+		T result{};
+		ReadMemory(addr, &result, sizeof(T));
+		return result;
+	}
+};
+
+size_t exMemoryBackend::ReadMemoryBatch(readRequest_t* requests, const size_t& count)
+{
+	size_t result{ 0 };
+	for (size_t i = 0; i < count; i++)
+	{
+		readRequest_t& request = requests[i];
+		request.bSuccess = request.buffer && ReadMemory(request.addr, request.buffer, request.szRead);
+		if (!request.bSuccess)
+		{
+			if (request.buffer)
+				memset(request.buffer, 0, request.szRead);	//	failed reads yield a zeroed destination
+
+			continue;
+		}
+
+		result++;
+	}
+
+	return result;
+}
+
+size_t exMemoryBackend::WriteMemoryBatch(writeRequest_t* requests, const size_t& count)
+{
+	size_t result{ 0 };
+	for (size_t i = 0; i < count; i++)
+	{
+		writeRequest_t& request = requests[i];
+		request.bSuccess = request.buffer && WriteMemory(request.addr, request.buffer, request.szWrite);
+		result += request.bSuccess;
+	}
+
+	return result;
+}
+
+size_t exMemoryBackend::ReadMemoryPartial(const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask)
+{
+	const size_t nPages = GetPageCount(addr, szRead);
+	if (pageMask)
+		pageMask->assign(nPages, false);
+
+	if (!buffer || !szRead)
+		return 0;
+
+	//	common case , everything is readable
+	if (ReadMemory(addr, buffer, szRead))
+	{
+		if (pageMask)
+			pageMask->assign(nPages, true);
+
+		return szRead;
+	}
+
+	//	split on page boundaries & read the pieces in fixed size batches
+	constexpr size_t szBatch = 64;
+	readRequest_t pieces[szBatch];
+	size_t result{ 0 };
+	size_t page{ 0 };
+	i64_t cursor = addr;
+	const i64_t end = addr + szRead;
+	while (cursor < end)
+	{
+		size_t count{ 0 };
+		for (; count < szBatch && cursor < end; count++)
+		{
+			const i64_t next = std::min<i64_t>((cursor / szPage + 1) * szPage, end);
+			pieces[count] = { cursor, static_cast<unsigned char*>(buffer) + (cursor - addr), size_t(next - cursor) };
+			cursor = next;
+		}
+
+		ReadMemoryBatch(pieces, count);
+		for (size_t i = 0; i < count; i++, page++)
+		{
+			if (!pieces[i].bSuccess)
+				continue;
+
+			result += pieces[i].szRead;
+			if (pageMask)
+				(*pageMask)[page] = true;
+		}
+	}
+
+	return result;
+}
+
+#if defined(_WIN32)
+
+/*
+*	ReadProcessMemory / WriteProcessMemory on a process handle
+*	closes the handle on destruction when constructed with bOwnsHandle
+*/
+class exWin32Backend : public exMemoryBackend
+{
+public:
+	explicit inline exWin32Backend(const HANDLE& hProc, const bool& bOwnsHandle = false) : hProc(hProc), bOwnsHandle(bOwnsHandle) {}
+	inline ~exWin32Backend() noexcept { if (bOwnsHandle && hProc && hProc != INVALID_HANDLE_VALUE) CloseHandle(hProc); }
+	exWin32Backend(const exWin32Backend&) = delete;
+	exWin32Backend& operator=(const exWin32Backend&) = delete;
+
+public:
+	inline bool ReadMemory(const i64_t& addr, void* buffer, const size_t& szRead) override { return ReadMemoryEx(hProc, addr, buffer, szRead); }
+	inline bool WriteMemory(const i64_t& addr, const void* buffer, const size_t& szWrite) override { return WriteMemoryEx(hProc, addr, buffer, szWrite); }
+
+	inline bool QueryRegion(const i64_t& addr, memRegion_t& region) override { return QueryRegionEx(hProc, addr, region); }
+	inline bool QueryRegions(std::vector<memRegion_t>& regions) override;
+	inline bool IsAlive() override { return IsAliveEx(hProc); }
+
+	/* returns the process handle used by the backend */
+	inline const HANDLE& GetHandle() const { return hProc; }
+
+public:
+
+	/* attempts to read memory at the specified address from the target process */
+	static inline bool ReadMemoryEx(const HANDLE& hProc, const i64_t& addr, void* buffer, const size_t& szRead)
+	{
+		SIZE_T size_read{};
+		SyscallCount()++;
+		return ReadProcessMemory(hProc, LPCVOID(addr), buffer, szRead, &size_read) && szRead == size_read;
+	}
+
+	/* attempts to write bytes to the specified address in memory from the target process */
+	static inline bool WriteMemoryEx(const HANDLE& hProc, const i64_t& addr, const void* buffer, const size_t& szWrite)
+	{
+		SIZE_T size_write{};
+		return WriteProcessMemory(hProc, LPVOID(addr), buffer, szWrite, &size_write) && szWrite == size_write;
+	}
+
+	/* returns false once the process has exited , a process handle is signaled when the process ends
+	* handles opened without SYNCHRONIZE fall back to the exit code
+	* ref: https://learn.microsoft.com/en-us/windows/win32/api/synchapi/nf-synchapi-waitforsingleobject
+	*/
+	static inline bool IsAliveEx(const HANDLE& hProc)
+	{
+		switch (WaitForSingleObject(hProc, 0))
+		{
+			case WAIT_TIMEOUT: return true;
+			case WAIT_OBJECT_0: return false;
+			default: break;
+		}
+
+		DWORD dwExitCode{};
+		return GetExitCodeProcess(hProc, &dwExitCode) && dwExitCode == STILL_ACTIVE;
+	}
+
+	/* queries the region containing the address with VirtualQueryEx
+	* ref: https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-virtualqueryex
+	*/
+	static inline bool QueryRegionEx(const HANDLE& hProc, const i64_t& addr, memRegion_t& region)
+	{
+		MEMORY_BASIC_INFORMATION mbi{};
+		if (!VirtualQueryEx(hProc, LPCVOID(addr), &mbi, sizeof(mbi)))
+			return false;
+
+		region.base = i64_t(mbi.BaseAddress);
+		region.size = mbi.RegionSize;
+		region.bReadable = mbi.State == MEM_COMMIT && mbi.Protect && !(mbi.Protect & (PAGE_NOACCESS | PAGE_GUARD));
+		return true;
+	}
+
+private:
+	HANDLE							hProc{ INVALID_HANDLE_VALUE };		//	handle to process
+	bool							bOwnsHandle{ false };				//	close the handle on destruction
+};
+
+bool exWin32Backend::QueryRegions(std::vector<memRegion_t>& regions)
+{
+	regions.clear();
+
+	memRegion_t region;
+	i64_t addr{ 0 };
+	while (QueryRegionEx(hProc, addr, region) && region.size)
+	{
+		if (region.bReadable)
+		{
+			if (!regions.empty() && regions.back().base + regions.back().size == region.base)
+				regions.back().size += region.size;	//	merge neighbouring readable regions
+			else
+				regions.push_back(region);
+		}
+
+		if (region.base + region.size <= addr)
+			break;	//	wrapped
+
+		addr = region.base + region.size;
+	}
+
+	return !regions.empty();
+}
+
+#elif defined(__linux__)
+
+//	process found under /proc
+typedef struct LINUXPROCINFO64
+{
+	pid_t							dwPID{ 0 };							//	process id
+	i64_t							dwModuleBase{ 0 };					//	first mapping of the executable
+	std::string						mProcName{ "" };					//	executable name
+	std::string						mProcPath{ "" };					//	executable path
+} LINUXPROCINFO32, linuxProcInfo_t;
+
+/*
+*	process_vm_readv / process_vm_writev on a process id
+*	batches pack as many iovecs as the kernel accepts into each call
+*	liveness is polled on a pidfd , which stays tied to the process even if its pid is reused
+*	ref: https://man7.org/linux/man-pages/man2/process_vm_readv.2.html
+*/
+class exLinuxBackend : public exMemoryBackend
+{
+public:
+	explicit inline exLinuxBackend(const pid_t& pid);
+	inline ~exLinuxBackend() noexcept { if (mPidFd >= 0) close(mPidFd); }
+	exLinuxBackend(const exLinuxBackend&) = delete;
+	exLinuxBackend& operator=(const exLinuxBackend&) = delete;
+
+public:
+	inline bool ReadMemory(const i64_t& addr, void* buffer, const size_t& szRead) override;
+	inline bool WriteMemory(const i64_t& addr, const void* buffer, const size_t& szWrite) override;
+	inline size_t ReadMemoryBatch(readRequest_t* requests, const size_t& count) override;
+	inline size_t WriteMemoryBatch(writeRequest_t* requests, const size_t& count) override;
+	inline bool QueryRegion(const i64_t& addr, memRegion_t& region) override;
+	inline bool QueryRegions(std::vector<memRegion_t>& regions) override;
+	inline bool IsAlive() override;
+	inline void NextGeneration() override { std::lock_guard<std::mutex> lock(mMapsMutex); bMapsValid = false; }
+
+	/* returns the process id used by the backend */
+	inline const pid_t& GetPID() const { return dwPID; }
+
+public:
+
+	/* finds processes by executable name ( case insensitive , empty for all ) straight from /proc
+	* phase 1 compares /proc/<pid>/comm , only the matches have their executable path & module base resolved
+	* windows executables under wine are matched by the name in argv[0]
+	*/
+	static inline bool FindProcessesEx(const std::string& name, std::vector<linuxProcInfo_t>& processes);
+
+	/* resolves one process by id , a windows executable under wine is named by argv[0] instead of the wine loader */
+	static inline bool FindProcessEx(const pid_t& pid, linuxProcInfo_t* lpResult);
+
+private:
+
+	/* fills executable path , name & module base of a process , name_cmp ( lowercase , empty for any ) must match the executable or argv[0] */
+	static inline bool ResolveProcess(const pid_t& pid, const std::string& name_cmp, linuxProcInfo_t& proc);
+
+	/* returns the file name of a path , both separators are accepted */
+	static inline std::string GetFileName(const std::string& path);
+
+	/* returns a lowercase copy */
+	static inline std::string ToLowerEx(std::string string) { std::transform(string.begin(), string.end(), string.begin(), [](unsigned char c) { return char(tolower(c)); }); return string; }
+
+private:
+	pid_t							dwPID{ 0 };							//	process id
+	int								mPidFd{ -1 };						//	pidfd of the process , -1 if the kernel has no pidfd_open
+	std::mutex						mMapsMutex;							//	guards the maps snapshot
+	std::vector<memRegion_t>		vmMaps;								//	maps snapshot for QueryRegion , parsed at most once per generation
+	bool							bMapsValid{ false };				//	snapshot was parsed in the current generation
+};
+
+exLinuxBackend::exLinuxBackend(const pid_t& pid) : dwPID(pid)
+{
+#if defined(SYS_pidfd_open)
+	mPidFd = int(syscall(SYS_pidfd_open, pid, 0));
+#endif
+}
+
+bool exLinuxBackend::IsAlive()
+{
+	//	a pidfd becomes readable when the process exits
+	if (mPidFd >= 0)
+	{
+		pollfd fd{ mPidFd, POLLIN, 0 };
+		const int ready = poll(&fd, 1, 0);
+		return ready == 0 || (ready < 0 && errno == EINTR);
+	}
+
+	return kill(dwPID, 0) == 0 || errno == EPERM;
+}
+
+bool exLinuxBackend::ReadMemory(const i64_t& addr, void* buffer, const size_t& szRead)
+{
+	iovec local{ buffer, szRead };
+	iovec remote{ reinterpret_cast<void*>(addr), szRead };
+	SyscallCount()++;
+	return process_vm_readv(dwPID, &local, 1, &remote, 1, 0) == ssize_t(szRead);
+}
+
+bool exLinuxBackend::WriteMemory(const i64_t& addr, const void* buffer, const size_t& szWrite)
+{
+	iovec local{ const_cast<void*>(buffer), szWrite };
+	iovec remote{ reinterpret_cast<void*>(addr), szWrite };
+	return process_vm_writev(dwPID, &local, 1, &remote, 1, 0) == ssize_t(szWrite);
+}
+
+size_t exLinuxBackend::ReadMemoryBatch(readRequest_t* requests, const size_t& count)
+{
+	//	per thread iovecs , reused between batches & safe for concurrent readers
+	thread_local std::vector<iovec> vmLocal;
+	thread_local std::vector<iovec> vmRemote;
+
+	size_t result{ 0 };
+	size_t next{ 0 };
+	while (next < count)
+	{
+		//	pack requests into iovecs
+		vmLocal.clear();
+		vmRemote.clear();
+		size_t end = next;
+		for (; end < count && vmLocal.size() < IOV_MAX; end++)
+		{
+			readRequest_t& request = requests[end];
+			request.bSuccess = false;
+			if (!request.buffer || !request.szRead)
+				continue;
+
+			vmLocal.push_back({ request.buffer, request.szRead });
+			vmRemote.push_back({ reinterpret_cast<void*>(request.addr), request.szRead });
+		}
+
+		//	the kernel stops at the first unreadable remote iovec , the bytes transferred tell us where
+		SyscallCount() += !vmLocal.empty();
+		ssize_t transferred = vmLocal.empty() ? 0 : process_vm_readv(dwPID, vmLocal.data(), vmLocal.size(), vmRemote.data(), vmRemote.size(), 0);
+		if (transferred < 0)
+		{
+			if (errno == ESRCH)	//	process is gone , nothing else will succeed
+			{
+				for (size_t i = next; i < count; i++)
+				{
+					requests[i].bSuccess = false;
+					if (requests[i].buffer)
+						memset(requests[i].buffer, 0, requests[i].szRead);
+				}
+
+				return result;
+			}
+
+			transferred = 0;
+		}
+
+		size_t cursor{ 0 };
+		size_t resume = end;
+		for (size_t i = next; i < end; i++)
+		{
+			readRequest_t& request = requests[i];
+			if (!request.buffer || !request.szRead)
+			{
+				request.bSuccess = request.buffer != nullptr;
+				result += request.bSuccess;
+				continue;
+			}
+
+			cursor += request.szRead;
+			if (cursor <= size_t(transferred))
+			{
+				request.bSuccess = true;
+				result++;
+				continue;
+			}
+
+			//	failed request , retry everything after it in the next call
+			memset(request.buffer, 0, request.szRead);
+			resume = i + 1;
+			break;
+		}
+
+		next = resume;
+	}
+
+	return result;
+}
+
+size_t exLinuxBackend::WriteMemoryBatch(writeRequest_t* requests, const size_t& count)
+{
+	thread_local std::vector<iovec> vmLocal;
+	thread_local std::vector<iovec> vmRemote;
+
+	size_t result{ 0 };
+	size_t next{ 0 };
+	while (next < count)
+	{
+		vmLocal.clear();
+		vmRemote.clear();
+		size_t end = next;
+		for (; end < count && vmLocal.size() < IOV_MAX; end++)
+		{
+			writeRequest_t& request = requests[end];
+			request.bSuccess = false;
+			if (!request.buffer || !request.szWrite)
+				continue;
+
+			vmLocal.push_back({ const_cast<void*>(request.buffer), request.szWrite });
+			vmRemote.push_back({ reinterpret_cast<void*>(request.addr), request.szWrite });
+		}
+
+		//	like reads , the kernel stops at the first unwritable remote iovec
+		ssize_t transferred = vmLocal.empty() ? 0 : process_vm_writev(dwPID, vmLocal.data(), vmLocal.size(), vmRemote.data(), vmRemote.size(), 0);
+		if (transferred < 0)
+		{
+			if (errno == ESRCH)
+				return result;
+
+			transferred = 0;
+		}
+
+		size_t cursor{ 0 };
+		size_t resume = end;
+		for (size_t i = next; i < end; i++)
+		{
+			writeRequest_t& request = requests[i];
+			if (!request.buffer || !request.szWrite)
+			{
+				request.bSuccess = request.buffer != nullptr;
+				result += request.bSuccess;
+				continue;
+			}
+
+			cursor += request.szWrite;
+			if (cursor <= size_t(transferred))
+			{
+				request.bSuccess = true;
+				result++;
+				continue;
+			}
+
+			//	failed request , retry everything after it in the next call
+			resume = i + 1;
+			break;
+		}
+
+		next = resume;
+	}
+
+	return result;
+}
+
+bool exLinuxBackend::QueryRegions(std::vector<memRegion_t>& regions)
+{
+	regions.clear();
+
+	const std::string path = "/proc/" + std::to_string(dwPID) + "/maps";
+	FILE* file = fopen(path.c_str(), "r");
+	if (!file)
+		return false;
+
+	//	start-end perms offset dev inode path
+	char line[512];
+	bool bLineStart{ true };
+	while (fgets(line, sizeof(line), file))
+	{
+		//	only the start of a line is parsed , the rest of an overlong line is skipped
+		const bool bParse = bLineStart;
+		bLineStart = strchr(line, '\n') != nullptr;
+		if (!bParse)
+			continue;
+
+		unsigned long long start{ 0 }, end{ 0 };
+		char perms[8]{};
+		if (sscanf(line, "%llx-%llx %7s", &start, &end, perms) != 3 || perms[0] != 'r' || end <= start)
+			continue;
+
+		if (!regions.empty() && regions.back().base + regions.back().size == i64_t(start))
+			regions.back().size += size_t(end - start);	//	merge neighbouring readable mappings
+		else
+			regions.push_back({ i64_t(start), size_t(end - start), true });
+	}
+	fclose(file);
+
+	return true;
+}
+
+bool exLinuxBackend::QueryRegion(const i64_t& addr, memRegion_t& region)
+{
+	//	single address queries are answered from one parse of the maps per generation
+	std::lock_guard<std::mutex> lock(mMapsMutex);
+	if (!bMapsValid && !QueryRegions(vmMaps))
+		return false;
+
+	bMapsValid = true;
+
+	//	first mapping ending after the address
+	auto it = std::upper_bound(vmMaps.begin(), vmMaps.end(), addr, [](const i64_t& value, const memRegion_t& map) { return value < map.base + map.size; });
+	if (it != vmMaps.end() && it->base <= addr)
+	{
+		region = *it;
+		return true;
+	}
+
+	//	unmapped gap between the previous & next mapping
+	region.base = it == vmMaps.begin() ? 0 : std::prev(it)->base + std::prev(it)->size;
+	region.size = size_t((it == vmMaps.end() ? ~i64_t(0) : it->base) - region.base);
+	region.bReadable = false;
+	return true;
+}
+
+bool exLinuxBackend::FindProcessesEx(const std::string& name, std::vector<linuxProcInfo_t>& processes)
+{
+	processes.clear();
+
+	DIR* dir = opendir("/proc");
+	if (!dir)
+		return false;
+
+	//	comm holds at most 15 characters of the name
+	const std::string& name_cmp = ToLowerEx(name);
+	const std::string& comm_cmp = name_cmp.substr(0, 15);
+
+	//	phase 1 : one small read per process
+	std::vector<pid_t> matches;
+	while (dirent* entry = readdir(dir))
+	{
+		char* end{ nullptr };
+		const long pid = strtol(entry->d_name, &end, 10);
+		if (pid <= 0 || *end)
+			continue;
+
+		if (!name_cmp.empty())
+		{
+			char comm[32]{};
+			const std::string path = "/proc/" + std::string(entry->d_name) + "/comm";
+			FILE* file = fopen(path.c_str(), "r");
+			if (!file)
+				continue;
+
+			const bool bRead = fgets(comm, sizeof(comm), file) != nullptr;
+			fclose(file);
+			comm[strcspn(comm, "\n")] = 0;
+			if (!bRead || ToLowerEx(comm) != comm_cmp)
+				continue;
+		}
+
+		matches.push_back(pid_t(pid));
+	}
+	closedir(dir);
+
+	//	phase 2 : executable path , full name & module base for the matches only
+	for (const pid_t& pid : matches)
+	{
+		linuxProcInfo_t proc;
+		if (ResolveProcess(pid, name_cmp, proc))
+			processes.push_back(proc);
+	}
+
+	return !processes.empty();
+}
+
+bool exLinuxBackend::FindProcessEx(const pid_t& pid, linuxProcInfo_t* lpResult)
+{
+	linuxProcInfo_t proc;
+	if (pid <= 0 || !ResolveProcess(pid, "", proc))
+		return false;
+
+	*lpResult = proc;
+
+	return true;
+}
+
+bool exLinuxBackend::ResolveProcess(const pid_t& pid, const std::string& name_cmp, linuxProcInfo_t& proc)
+{
+	const std::string root = "/proc/" + std::to_string(pid);
+	proc.dwPID = pid;
+
+	char exe[PATH_MAX]{};
+	const ssize_t szExe = readlink((root + "/exe").c_str(), exe, sizeof(exe) - 1);
+	if (szExe > 0)
+		proc.mProcPath = std::string(exe, size_t(szExe));
+
+	proc.mProcName = GetFileName(proc.mProcPath);
+
+	//	wine keeps the windows path in argv[0] , the executable is the wine loader
+	const bool bWine = ToLowerEx(proc.mProcName).rfind("wine", 0) == 0;
+	if ((!name_cmp.empty() && ToLowerEx(proc.mProcName) != name_cmp) || (name_cmp.empty() && bWine))
+	{
+		char argv0[PATH_MAX]{};
+		FILE* file = fopen((root + "/cmdline").c_str(), "r");
+		if (!file)
+			return false;
+
+		const size_t szArg = fread(argv0, 1, sizeof(argv0) - 1, file);
+		fclose(file);
+		const std::string& arg = std::string(argv0, strnlen(argv0, szArg));
+		if (!name_cmp.empty() && ToLowerEx(GetFileName(arg)) != name_cmp)
+			return false;
+
+		if (!arg.empty())
+		{
+			proc.mProcName = GetFileName(arg);
+			proc.mProcPath = arg;
+		}
+	}
+
+	if (proc.mProcName.empty())
+		return false;
+
+	//	first mapping of a file with the executable name
+	FILE* maps = fopen((root + "/maps").c_str(), "r");
+	if (maps)
+	{
+		char line[512];
+		const std::string& file_cmp = ToLowerEx(proc.mProcName);
+		while (fgets(line, sizeof(line), maps))
+		{
+			char* path = strchr(line, '/');
+			if (!path)
+				continue;
+
+			path[strcspn(path, "\n")] = 0;
+			if (ToLowerEx(GetFileName(path)) != file_cmp)
+				continue;
+
+			proc.dwModuleBase = i64_t(strtoull(line, nullptr, 16));
+			break;
+		}
+		fclose(maps);
+	}
+
+	return true;
+}
+
+std::string exLinuxBackend::GetFileName(const std::string& path)
+{
+	const size_t pos = path.find_last_of("/\\");
+	return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+#if defined(EXMEMORY_IO_URING)
+
+/*
+*	asynchronous reads through io_uring on /proc/<pid>/mem
+*	keeps up to mDepth preads in flight and completes requests as their cqes arrive
+*	falls back to process_vm_readv when a ring cannot be created or stops working
+*	opt in through exMemory::SetBackend , /proc/<pid>/mem reads run on io-wq workers & are slower than exLinuxBackend batches on current kernels , see bench/uring_bench.cpp
+*	ref: https://man7.org/linux/man-pages/man7/io_uring.7.html
+*/
+class exUringBackend : public exLinuxBackend
+{
+public:
+	explicit inline exUringBackend(const pid_t& pid, const unsigned int& depth = 256);
+	inline ~exUringBackend() noexcept;
+
+	exUringBackend(const exUringBackend&) = delete;
+	exUringBackend& operator=(const exUringBackend&) = delete;
+
+public:
+	inline bool ReadMemory(const i64_t& addr, void* buffer, const size_t& szRead) override;
+	inline size_t ReadMemoryBatch(readRequest_t* requests, const size_t& count) override;
+
+	/* returns true if the ring & /proc/<pid>/mem were opened & the ring has not failed since */
+	inline bool IsRingValid() const { return fdRing >= 0 && fdMem >= 0; }
+
+private:
+
+	/* pushes a read sqe , returns false if the submission queue is full */
+	inline bool PushRead(const int& fd, void* buffer, const size_t& szRead, const i64_t& addr, const unsigned long long& userData);
+
+	/* completes the requests of every available cqe , returns the number that were read completely */
+	inline size_t ReapCompletions(readRequest_t* requests, unsigned int& inflight);
+
+	/* waits for every read the kernel took from the ring , sqes it never took are read synchronously
+	* called before the ring is closed so no completion can land in a buffer the caller already released
+	*/
+	inline size_t DrainRing(readRequest_t* requests, unsigned int& inflight);
+
+	/* closes the ring & unmaps the queues */
+	inline void CloseRing();
+
+private:
+	int								fdMem{ -1 };						//	/proc/<pid>/mem
+	std::atomic<int>				fdRing{ -1 };						//	io_uring instance , -1 once the ring failed
+	std::mutex						mRingMutex;							//	serializes ring submissions
+	unsigned int					mDepth{ 0 };						//	submission queue entries
+
+	void*							pSqRing{ nullptr };					//	submission queue ring mapping
+	size_t							szSqRing{ 0 };
+	void*							pCqRing{ nullptr };					//	completion queue ring mapping
+	size_t							szCqRing{ 0 };
+	io_uring_sqe*					pSqes{ nullptr };					//	submission queue entries mapping
+	size_t							szSqes{ 0 };
+
+	unsigned int*					pSqHead{ nullptr };
+	unsigned int*					pSqTail{ nullptr };
+	unsigned int*					pSqMask{ nullptr };
+	unsigned int*					pSqArray{ nullptr };
+	unsigned int*					pCqHead{ nullptr };
+	unsigned int*					pCqTail{ nullptr };
+	unsigned int*					pCqMask{ nullptr };
+	io_uring_cqe*					pCqes{ nullptr };
+};
+
+exUringBackend::exUringBackend(const pid_t& pid, const unsigned int& depth) : exLinuxBackend(pid)
+{
+	const std::string path = "/proc/" + std::to_string(pid) + "/mem";
+	fdMem = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fdMem < 0)
+		return;
+
+	io_uring_params params{};
+	fdRing = int(syscall(__NR_io_uring_setup, depth, &params));
+	if (fdRing < 0)
+		return;
+
+	mDepth = params.sq_entries;
+
+	//	map submission & completion rings
+	szSqRing = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+	szCqRing = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	szSqes = params.sq_entries * sizeof(io_uring_sqe);
+	pSqRing = mmap(nullptr, szSqRing, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fdRing, IORING_OFF_SQ_RING);
+	pCqRing = mmap(nullptr, szCqRing, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fdRing, IORING_OFF_CQ_RING);
+	void* sqes = mmap(nullptr, szSqes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fdRing, IORING_OFF_SQES);
+	if (pSqRing == MAP_FAILED || pCqRing == MAP_FAILED || sqes == MAP_FAILED)
+	{
+		pSqRing = pSqRing == MAP_FAILED ? nullptr : pSqRing;
+		pCqRing = pCqRing == MAP_FAILED ? nullptr : pCqRing;
+		if (sqes != MAP_FAILED)
+			munmap(sqes, szSqes);
+
+		CloseRing();
+		return;
+	}
+	pSqes = static_cast<io_uring_sqe*>(sqes);
+
+	auto sq = static_cast<unsigned char*>(pSqRing);
+	pSqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+	pSqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+	pSqMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+	pSqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+
+	auto cq = static_cast<unsigned char*>(pCqRing);
+	pCqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+	pCqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+	pCqMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+	pCqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+exUringBackend::~exUringBackend()
+{
+	CloseRing();
+
+	if (fdMem >= 0)
+		close(fdMem);
+}
+
+void exUringBackend::CloseRing()
+{
+	const int fd = fdRing.exchange(-1);	//	invalid before the queues are unmapped
+
+	if (pSqes)
+		munmap(pSqes, szSqes);
+
+	if (pCqRing)
+		munmap(pCqRing, szCqRing);
+
+	if (pSqRing)
+		munmap(pSqRing, szSqRing);
+
+	if (fd >= 0)
+		close(fd);
+
+	pSqes = nullptr;
+	pCqRing = nullptr;
+	pSqRing = nullptr;
+}
+
+bool exUringBackend::ReadMemory(const i64_t& addr, void* buffer, const size_t& szRead)
+{
+	if (fdMem < 0)
+		return exLinuxBackend::ReadMemory(addr, buffer, szRead);
+
+	SyscallCount()++;
+	return pread(fdMem, buffer, szRead, off_t(addr)) == ssize_t(szRead);
+}
+
+bool exUringBackend::PushRead(const int& fd, void* buffer, const size_t& szRead, const i64_t& addr, const unsigned long long& userData)
+{
+	const unsigned int tail = *pSqTail;
+	const unsigned int head = std::atomic_ref<unsigned int>(*pSqHead).load(std::memory_order_acquire);
+	if (tail - head >= mDepth)
+		return false;
+
+	const unsigned int index = tail & *pSqMask;
+	io_uring_sqe& sqe = pSqes[index];
+	memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_READ;
+	sqe.fd = fd;
+	sqe.addr = reinterpret_cast<unsigned long long>(buffer);
+	sqe.len = static_cast<unsigned int>(szRead);
+	sqe.off = addr;
+	sqe.user_data = userData;
+	pSqArray[index] = index;
+
+	std::atomic_ref<unsigned int>(*pSqTail).store(tail + 1, std::memory_order_release);
+
+	return true;
+}
+
+size_t exUringBackend::ReadMemoryBatch(readRequest_t* requests, const size_t& count)
+{
+	std::unique_lock<std::mutex> lock(mRingMutex);	//	one submitter at a time , the ring may be closed by a failed batch
+	if (!IsRingValid())
+	{
+		lock.unlock();
+		return exLinuxBackend::ReadMemoryBatch(requests, count);
+	}
+
+	size_t result{ 0 };
+	size_t next{ 0 };
+	size_t done{ 0 };
+	unsigned int inflight{ 0 };
+	while (done < count)
+	{
+		//	fill the submission queue
+		while (next < count && inflight < mDepth)
+		{
+			readRequest_t& request = requests[next];
+			request.bSuccess = false;
+			if (!request.buffer || !request.szRead || request.szRead > 0x7FFFF000)
+			{
+				//	empty & oversized requests are completed synchronously
+				request.bSuccess = request.buffer && (!request.szRead || ReadMemory(request.addr, request.buffer, request.szRead));
+				result += request.bSuccess;
+				done++;
+				next++;
+				continue;
+			}
+
+			if (!PushRead(fdMem, request.buffer, request.szRead, request.addr, next))
+				break;
+
+			inflight++;
+			next++;
+		}
+
+		if (!inflight)
+			continue;
+
+		//	submit pending sqes & wait for at least one completion
+		const unsigned int pending = *pSqTail - std::atomic_ref<unsigned int>(*pSqHead).load(std::memory_order_acquire);
+		SyscallCount()++;
+		if (syscall(__NR_io_uring_enter, fdRing.load(), pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+		{
+			//	the ring is unusable , reads in flight are finished before it is closed & later batches use process_vm_readv
+			result += DrainRing(requests, inflight);
+			CloseRing();
+			break;
+		}
+
+		const unsigned int before = inflight;
+		result += ReapCompletions(requests, inflight);
+		done += before - inflight;
+	}
+
+	if (next < count)
+		result += exLinuxBackend::ReadMemoryBatch(requests + next, count - next);
+
+	return result;
+}
+
+size_t exUringBackend::ReapCompletions(readRequest_t* requests, unsigned int& inflight)
+{
+	size_t result{ 0 };
+	unsigned int head = *pCqHead;
+	const unsigned int tail = std::atomic_ref<unsigned int>(*pCqTail).load(std::memory_order_acquire);
+	for (; head != tail; head++)
+	{
+		const io_uring_cqe& cqe = pCqes[head & *pCqMask];
+		readRequest_t& request = requests[cqe.user_data];
+		request.bSuccess = cqe.res == int(request.szRead);
+		if (!request.bSuccess)
+			memset(request.buffer, 0, request.szRead);	//	failed reads yield a zeroed destination
+
+		result += request.bSuccess;
+		inflight--;
+	}
+	std::atomic_ref<unsigned int>(*pCqHead).store(head, std::memory_order_release);
+
+	return result;
+}
+
+size_t exUringBackend::DrainRing(readRequest_t* requests, unsigned int& inflight)
+{
+	size_t result{ 0 };
+
+	//	sqes the kernel did not take will never complete
+	const unsigned int head = std::atomic_ref<unsigned int>(*pSqHead).load(std::memory_order_acquire);
+	for (unsigned int i = head; i != *pSqTail; i++)
+	{
+		readRequest_t& request = requests[pSqes[pSqArray[i & *pSqMask]].user_data];
+		result += exLinuxBackend::ReadMemoryBatch(&request, 1);
+		inflight--;
+	}
+	std::atomic_ref<unsigned int>(*pSqTail).store(head, std::memory_order_release);
+
+	//	taken reads post their cqe whether or not io_uring_enter works , poll the mapped completion queue
+	while (inflight)
+	{
+		const unsigned int before = inflight;
+		result += ReapCompletions(requests, inflight);
+		if (inflight == before)
+			usleep(50);
+	}
+
+	return result;
+}
+
+#endif
+#endif
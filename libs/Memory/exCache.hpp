@@ -0,0 +1,516 @@
+//	exMemory read cache | page granular copies of remote memory for one update generation
+
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "exBackend.hpp"
+#include "exPlanner.hpp"
+
+//	read cache counters
+typedef struct READCACHESTATS64
+{
+	size_t							mHits{ 0 };							//	page lookups served from a local copy
+	size_t							mMisses{ 0 };						//	page lookups fetched from the target process
+	size_t							mBytesRead{ 0 };					//	bytes fetched from the target process
+	size_t							mBytesServed{ 0 };					//	bytes copied out to callers
+	size_t							mBypassed{ 0 };						//	reads that skipped the cache ( too large or unreadable page )
+	size_t							mPrefetched{ 0 };					//	pages fetched ahead from the previous generation's trace
+	size_t							mPrefetchHits{ 0 };					//	prefetched pages that were used
+} READCACHESTATS32, readCacheStats_t;
+
+/*
+*	each remote page is fetched at most once per generation , smaller reads are served from the local copy
+*	missing pages of a read ( or a whole batch ) are fetched in one backend batch , neighbouring pages are merged by the read planner
+*	with prefetch enabled the pages used in a generation are traced & Prefetch fetches them in one batch at the start of the next
+*	a page that handed out a view is never refetched or freed in the same generation , Invalidate & Clear retire it until NextGeneration
+*/
+class exPageCache
+{
+public:
+	static constexpr size_t			szPage = 0x1000;					//	cache granularity
+	static constexpr size_t			szMaxCachedRead = 0x4000;			//	larger reads go straight to the backend
+	static constexpr size_t			mMaxPages = 0x4000;					//	pages kept before stale pages are evicted
+
+public:
+
+	/* reads through the cache , fetching pages that are not fresh in the current generation
+	* a read touching an unreadable page fails without another backend read & is zeroed
+	* returns true if all bytes were read
+	*/
+	inline bool Read(exMemoryBackend& backend, const i64_t& addr, void* buffer, const size_t& szRead);
+
+	/* reads as much of a range as possible through the cache , unreadable pages are zeroed
+	* see: exMemoryBackend::ReadMemoryPartial
+	*/
+	inline size_t ReadPartial(exMemoryBackend& backend, const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask);
+
+	/* returns a pointer to the cached copy of a range inside a single page , fetching the page if it is not fresh
+	* the pointer stays valid & unchanged until the next generation , even if the page is invalidated or the cache is cleared
+	* returns nullptr if the range crosses a page or is unreadable
+	*/
+	inline const void* View(exMemoryBackend& backend, const i64_t& addr, const size_t& szRead);
+
+	/* reads a list of requests through the cache , every missing page is fetched in a single backend batch
+	* returns the number of requests that were read completely
+	*/
+	inline size_t ReadBatch(exMemoryBackend& backend, readRequest_t* requests, const size_t& count);
+
+	/* starts a new generation , pages fetched in previous generations are refetched on next use & retired pages are freed */
+	inline void NextGeneration();
+
+	/* fetches every page used in the previous generation that is not fresh yet in one batch
+	* reads that follow are served from the prefetched pages , a pointer that moved simply misses & is fetched as usual
+	* returns the number of pages fetched
+	*/
+	inline size_t Prefetch(exMemoryBackend& backend);
+
+	/* enables or disables tracing the pages used in each generation for Prefetch */
+	inline void SetPrefetch(const bool& bEnable);
+
+	/* drops cached pages overlapping the range , used after writes
+	* a page with views in this generation is retired instead of being refetched in place
+	*/
+	inline void Invalidate(const i64_t& addr, const size_t& size);
+
+	/* drops all cached pages , pages with views in this generation are retired */
+	inline void Clear();
+
+	/* returns the current generation */
+	inline unsigned long long GetGeneration();
+
+	/* returns a copy of the cache counters */
+	inline readCacheStats_t GetStats();
+
+	/* resets the cache counters */
+	inline void ResetStats();
+
+	/* sets the largest gap in bytes between missing pages that are still fetched in one read , 0 merges contiguous pages only */
+	inline void SetCoalesceGap(const size_t& gap);
+
+private:
+	struct SPage
+	{
+		unsigned long long			mGeneration{ 0 };					//	generation the page was fetched in
+		bool						bValid{ false };					//	page was readable when fetched
+		bool						bPrefetched{ false };				//	fetched by Prefetch & not used yet
+		unsigned long long			mTraced{ 0 };						//	generation the page was last traced in
+		unsigned long long			mViewed{ 0 };						//	generation the page last handed out a view in
+		alignas(16) unsigned char	data[szPage];						//	local copy , aligned for views
+	};
+
+	/* returns the page at the base address , creating it if needed */
+	inline SPage& GetPage(const i64_t& base);
+
+	/* collects pages in the range that are not fresh , returns the number of page lookups */
+	inline size_t CollectMissing(const i64_t& addr, const size_t& size);
+
+	/* fetches the collected missing pages in one batch */
+	inline void FetchMissing(exMemoryBackend& backend);
+
+	/* copies a range from fresh pages , returns false if a page in the range was unreadable */
+	inline bool CopyOut(const i64_t& addr, void* buffer, const size_t& size);
+
+	/* returns true if the page handed out a view in the current generation & must not change until NextGeneration */
+	inline bool IsPinned(const SPage& page) const { return page.mViewed == mGeneration; }
+
+private:
+	std::mutex										mMutex;
+	std::unordered_map<i64_t, std::unique_ptr<SPage>>	vmPages;		//	page base -> local copy
+	unsigned long long								mGeneration{ 1 };	//	current generation
+	readCacheStats_t								mStats;				//	counters
+	exReadPlanner									mPlanner{ 0, szPage * 64 };	//	merges page fetches
+	bool											bPrefetch{ false };	//	trace used pages for Prefetch
+	std::vector<i64_t>								vmTrace;			//	pages used in the current generation
+	std::vector<i64_t>								vmPrefetch;			//	pages used in the previous generation
+	std::vector<std::unique_ptr<SPage>>				vmRetired;			//	dropped pages with views , freed by NextGeneration
+
+	std::vector<i64_t>								vmMissing;			//	page bases to fetch , reused
+	std::vector<unsigned char>						vmScratch;			//	fetch buffer , reused
+	std::vector<readRequest_t>						vmFetch;			//	fetch requests , reused
+	std::vector<readRequest_t>						vmDirect;			//	requests that skip the cache , reused
+	std::vector<size_t>								vmDirectIndex;		//	index of each direct request in the callers list
+};
+
+bool exPageCache::Read(exMemoryBackend& backend, const i64_t& addr, void* buffer, const size_t& szRead)
+{
+	if (!szRead)
+		return true;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (szRead > szMaxCachedRead)
+	{
+		mStats.mBypassed++;
+		return backend.ReadMemory(addr, buffer, szRead);
+	}
+
+	vmMissing.clear();
+	const size_t lookups = CollectMissing(addr, szRead);
+	mStats.mHits += lookups - vmMissing.size();
+	mStats.mMisses += vmMissing.size();
+	FetchMissing(backend);
+
+	//	every page is fresh now , a page that failed was already retried on its own by the planner & the read cannot succeed
+	if (!CopyOut(addr, buffer, szRead))
+	{
+		memset(buffer, 0, szRead);
+		return false;
+	}
+
+	mStats.mBytesServed += szRead;
+
+	return true;
+}
+
+size_t exPageCache::ReadPartial(exMemoryBackend& backend, const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask)
+{
+	if (!buffer || !szRead || szRead > szMaxCachedRead)
+	{
+		if (szRead > szMaxCachedRead)
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStats.mBypassed++;
+		}
+
+		return backend.ReadMemoryPartial(addr, buffer, szRead, pageMask);
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	vmMissing.clear();
+	const size_t lookups = CollectMissing(addr, szRead);
+	mStats.mHits += lookups - vmMissing.size();
+	mStats.mMisses += vmMissing.size();
+	FetchMissing(backend);
+
+	if (pageMask)
+		pageMask->assign(lookups, false);
+
+	//	copy valid pages , zero the rest
+	size_t result{ 0 };
+	size_t index{ 0 };
+	auto out = static_cast<unsigned char*>(buffer);
+	i64_t cursor = addr;
+	size_t remaining = szRead;
+	for (; remaining; index++)
+	{
+		const i64_t base = cursor & ~i64_t(szPage - 1);
+		const size_t offset = size_t(cursor - base);
+		const size_t chunk = std::min(remaining, szPage - offset);
+
+		const SPage& page = GetPage(base);
+		if (page.bValid)
+		{
+			memcpy(out, page.data + offset, chunk);
+			result += chunk;
+			if (pageMask)
+				(*pageMask)[index] = true;
+		}
+		else
+			memset(out, 0, chunk);
+
+		out += chunk;
+		cursor += chunk;
+		remaining -= chunk;
+	}
+	mStats.mBytesServed += result;
+
+	return result;
+}
+
+const void* exPageCache::View(exMemoryBackend& backend, const i64_t& addr, const size_t& szRead)
+{
+	const i64_t base = addr & ~i64_t(szPage - 1);
+	if (!szRead || szRead > szPage || ((addr + szRead - 1) & ~i64_t(szPage - 1)) != base)
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	vmMissing.clear();
+	const size_t lookups = CollectMissing(addr, szRead);
+	mStats.mHits += lookups - vmMissing.size();
+	mStats.mMisses += vmMissing.size();
+	FetchMissing(backend);
+
+	SPage& page = GetPage(base);
+	if (!page.bValid)
+		return nullptr;
+
+	page.mViewed = mGeneration;
+	mStats.mBytesServed += szRead;
+
+	return page.data + (addr - base);
+}
+
+size_t exPageCache::ReadBatch(exMemoryBackend& backend, readRequest_t* requests, const size_t& count)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	//	collect every missing page of the batch
+	size_t lookups{ 0 };
+	vmMissing.clear();
+	for (size_t i = 0; i < count; i++)
+	{
+		const readRequest_t& request = requests[i];
+		if (!request.buffer || !request.szRead || request.szRead > szMaxCachedRead)
+			continue;
+
+		lookups += CollectMissing(request.addr, request.szRead);
+	}
+	std::sort(vmMissing.begin(), vmMissing.end());
+	vmMissing.erase(std::unique(vmMissing.begin(), vmMissing.end()), vmMissing.end());
+	mStats.mHits += lookups - vmMissing.size();
+	mStats.mMisses += vmMissing.size();
+	FetchMissing(backend);
+
+	//	serve requests from pages , anything else is read directly in one batch
+	size_t result{ 0 };
+	vmDirect.clear();
+	vmDirectIndex.clear();
+	for (size_t i = 0; i < count; i++)
+	{
+		readRequest_t& request = requests[i];
+		request.bSuccess = request.buffer != nullptr && !request.szRead;
+		if (!request.buffer || !request.szRead)
+		{
+			result += request.bSuccess;
+			continue;
+		}
+
+		if (request.szRead <= szMaxCachedRead)
+		{
+			//	a failed copy means a page of the request was unreadable , failed locally like Read
+			request.bSuccess = CopyOut(request.addr, request.buffer, request.szRead);
+			if (!request.bSuccess)
+				memset(request.buffer, 0, request.szRead);
+
+			mStats.mBytesServed += request.bSuccess ? request.szRead : 0;
+			result += request.bSuccess;
+			continue;
+		}
+
+		mStats.mBypassed++;
+		vmDirect.push_back(request);
+		vmDirectIndex.push_back(i);
+	}
+
+	if (!vmDirect.empty())
+	{
+		result += backend.ReadMemoryBatch(vmDirect.data(), vmDirect.size());
+		for (size_t i = 0; i < vmDirect.size(); i++)
+			requests[vmDirectIndex[i]].bSuccess = vmDirect[i].bSuccess;
+	}
+
+	return result;
+}
+
+void exPageCache::NextGeneration()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mGeneration++;
+	vmRetired.clear();
+
+	//	last generation's trace is the next prefetch
+	if (bPrefetch)
+	{
+		vmPrefetch.swap(vmTrace);
+		vmTrace.clear();
+	}
+
+	//	evict pages that have not been used for a while
+	if (vmPages.size() <= mMaxPages)
+		return;
+
+	for (auto it = vmPages.begin(); it != vmPages.end();)
+	{
+		if (it->second->mGeneration + 8 < mGeneration)
+			it = vmPages.erase(it);
+		else
+			++it;
+	}
+}
+
+size_t exPageCache::Prefetch(exMemoryBackend& backend)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (!bPrefetch || vmPrefetch.empty())
+		return 0;
+
+	//	pages that failed last time are left to the regular path
+	vmMissing.clear();
+	for (const i64_t& base : vmPrefetch)
+	{
+		SPage& page = GetPage(base);
+		if (page.bValid && page.mGeneration != mGeneration)
+			vmMissing.push_back(base);
+	}
+	vmPrefetch.clear();
+
+	std::sort(vmMissing.begin(), vmMissing.end());
+	FetchMissing(backend);
+	for (const i64_t& base : vmMissing)
+		GetPage(base).bPrefetched = true;
+
+	mStats.mPrefetched += vmMissing.size();
+
+	return vmMissing.size();
+}
+
+void exPageCache::SetPrefetch(const bool& bEnable)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	bPrefetch = bEnable;
+	vmTrace.clear();
+	vmPrefetch.clear();
+}
+
+void exPageCache::Invalidate(const i64_t& addr, const size_t& size)
+{
+	if (!size)
+		return;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	const i64_t first = addr & ~i64_t(szPage - 1);
+	const i64_t last = (addr + size - 1) & ~i64_t(szPage - 1);
+	for (i64_t base = first; base <= last; base += szPage)
+	{
+		auto it = vmPages.find(base);
+		if (it == vmPages.end())
+			continue;
+
+		//	views of the page keep the old copy , the next read fetches a new page
+		if (IsPinned(*it->second))
+		{
+			vmRetired.push_back(std::move(it->second));
+			vmPages.erase(it);
+		}
+		else
+			it->second->mGeneration = 0;
+	}
+}
+
+void exPageCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (auto& [base, page] : vmPages)
+	{
+		if (IsPinned(*page))
+			vmRetired.push_back(std::move(page));
+	}
+	vmPages.clear();
+}
+
+unsigned long long exPageCache::GetGeneration()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mGeneration;
+}
+
+readCacheStats_t exPageCache::GetStats()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mStats;
+}
+
+void exPageCache::ResetStats()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mStats = readCacheStats_t();
+}
+
+void exPageCache::SetCoalesceGap(const size_t& gap)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mPlanner.SetGap(gap);
+}
+
+exPageCache::SPage& exPageCache::GetPage(const i64_t& base)
+{
+	auto& page = vmPages[base];
+	if (!page)
+		page = std::make_unique<SPage>();
+
+	return *page;
+}
+
+size_t exPageCache::CollectMissing(const i64_t& addr, const size_t& size)
+{
+	size_t lookups{ 0 };
+	const i64_t first = addr & ~i64_t(szPage - 1);
+	const i64_t last = (addr + size - 1) & ~i64_t(szPage - 1);
+	for (i64_t base = first; base <= last; base += szPage)
+	{
+		lookups++;
+		SPage& page = GetPage(base);
+		if (page.mGeneration != mGeneration)
+			vmMissing.push_back(base);
+		else if (page.bPrefetched)
+		{
+			page.bPrefetched = false;
+			mStats.mPrefetchHits++;
+		}
+
+		if (bPrefetch && page.mTraced != mGeneration && vmTrace.size() < mMaxPages)
+		{
+			page.mTraced = mGeneration;
+			vmTrace.push_back(base);
+		}
+	}
+
+	return lookups;
+}
+
+void exPageCache::FetchMissing(exMemoryBackend& backend)
+{
+	if (vmMissing.empty())
+		return;
+
+	//	one request per page , the planner merges neighbouring pages and retries pages of a failed span on their own
+	vmScratch.resize(vmMissing.size() * szPage);
+	vmFetch.clear();
+	for (size_t i = 0; i < vmMissing.size(); i++)
+		vmFetch.push_back({ vmMissing[i], vmScratch.data() + i * szPage, szPage });
+
+	const readPlanStats_t before = mPlanner.GetStats();
+	mPlanner.Execute(backend, vmFetch.data(), vmFetch.size());
+	mStats.mBytesRead += mPlanner.GetStats().mBytesRead - before.mBytesRead;
+
+	//	store pages
+	for (const readRequest_t& fetch : vmFetch)
+	{
+		SPage& page = GetPage(fetch.addr);
+		page.mGeneration = mGeneration;
+		page.bValid = fetch.bSuccess;
+		page.bPrefetched = false;
+		if (fetch.bSuccess)
+			memcpy(page.data, fetch.buffer, szPage);
+	}
+}
+
+bool exPageCache::CopyOut(const i64_t& addr, void* buffer, const size_t& size)
+{
+	auto out = static_cast<unsigned char*>(buffer);
+	i64_t cursor = addr;
+	size_t remaining = size;
+	while (remaining)
+	{
+		const i64_t base = cursor & ~i64_t(szPage - 1);
+		const size_t offset = size_t(cursor - base);
+		const size_t chunk = std::min(remaining, szPage - offset);
+
+		auto it = vmPages.find(base);
+		if (it == vmPages.end() || it->second->mGeneration != mGeneration || !it->second->bValid)
+			return false;
+
+		memcpy(out, it->second->data + offset, chunk);
+		out += chunk;
+		cursor += chunk;
+		remaining -= chunk;
+	}
+
+	return true;
+}
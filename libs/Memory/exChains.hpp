@@ -0,0 +1,64 @@
+//	exMemory pointer chains | resolved pointer chains that are revalidated instead of re-walked
+
+#pragma once
+#include <initializer_list>
+#include <vector>
+#include "exBackend.hpp"
+
+//	pointer chain counters
+typedef struct POINTERCHAINSTATS64
+{
+	size_t							mResolves{ 0 };						//	calls to resolve the chain
+	size_t							mRevalidations{ 0 };				//	batched checks of the cached links
+	size_t							mWalks{ 0 };						//	links read one by one after a mismatch
+} POINTERCHAINSTATS32, pointerChainStats_t;
+
+/*
+*	a pointer chain in the same form as ReadPointerChain , result = *( *( *base + offsets[0] ) + offsets[1] ) ...
+*	stores the pointer read at each link , resolved through exMemory::ResolvePointerChain
+*	once resolved the chain is checked by reading every cached link in one batch , the walk resumes at the first link that changed
+*/
+class exPointerChain
+{
+	friend class exMemory;
+
+public:
+	explicit inline exPointerChain(const i64_t& base = 0, std::initializer_list<unsigned int> offsets = {}) : mBase(base), vmOffsets(offsets), vmLinks(offsets.size()) {}
+
+public:
+
+	/* sets the address the chain starts at , a different base invalidates the chain */
+	inline void SetBase(const i64_t& base) { if (base != mBase) Invalidate(); mBase = base; }
+	inline const i64_t& GetBase() const { return mBase; }
+
+	/* returns the offsets applied after each link */
+	inline const std::vector<unsigned int>& GetOffsets() const { return vmOffsets; }
+
+	/* returns the pointer read at a link , valid after a successful resolve
+	* link 0 is the pointer stored at the base address
+	*/
+	inline i64_t GetLink(const size_t& index) const { return bValid && index < vmLinks.size() ? vmLinks[index] : 0; }
+
+	/* returns the address the chain resolved to , 0 if it could not be resolved */
+	inline const i64_t& GetResult() const { return mResult; }
+
+	/* returns true if the cached links resolved the chain */
+	inline bool IsValid() const { return bValid; }
+
+	/* forces a full walk on the next resolve */
+	inline void Invalidate() { bValid = false; mResult = 0; mGeneration = 0; }
+
+	/* returns the chain counters */
+	inline const pointerChainStats_t& GetStats() const { return mStats; }
+
+private:
+	i64_t							mBase{ 0 };							//	address of the first pointer
+	std::vector<unsigned int>		vmOffsets;							//	offset added after each link
+	std::vector<i64_t>				vmLinks;							//	pointer read at each link
+	std::vector<i64_t>				vmCheck;							//	links read back during revalidation , reused
+	std::vector<readRequest_t>		vmRequests;							//	revalidation requests , reused
+	i64_t							mResult{ 0 };						//	resolved address
+	bool							bValid{ false };					//	links are resolved
+	unsigned long long				mGeneration{ 0 };					//	generation the chain was last checked in
+	pointerChainStats_t				mStats;								//	counters
+};
@@ -0,0 +1,71 @@
+//	exMemory read epoch | lets readers use published state without locks while writers wait for them before freeing it
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <thread>
+
+/*
+*	readers pin the epoch for the length of one operation , writers publish new state & call Synchronize before freeing the old one
+*	each thread counts its pins in its own slot , so a pin costs two uncontended atomic adds & never waits for a writer
+*	the epoch parity picks the counter a pin goes to , Synchronize flips it twice & waits for each old parity to drain
+*	pins may nest , Synchronize must not be called while the calling thread holds a pin
+*/
+class exEpoch
+{
+public:
+	static constexpr size_t			szSlots = 64;						//	threads beyond this share slots , which costs contention but stays correct
+
+public:
+
+	/* pins the current epoch for the calling thread , returns the token to pass to Unpin */
+	inline size_t Pin() const;
+
+	/* releases a pin taken by Pin */
+	inline void Unpin(const size_t& token) const;
+
+	/* waits until every pin taken before the call is released , pins taken during the call are not waited for once they see the new state */
+	inline void Synchronize();
+
+private:
+	struct alignas(64) SSlot
+	{
+		std::atomic<size_t>			vmPins[2]{};						//	pins held by the slot's threads , by epoch parity
+	};
+
+	/* returns the slot of the calling thread */
+	static inline size_t GetSlot() { static std::atomic<size_t> mNext{ 0 }; thread_local const size_t slot = mNext.fetch_add(1, std::memory_order_relaxed) % szSlots; return slot; }
+
+private:
+	std::atomic<size_t>				mEpoch{ 0 };						//	flipped twice by every Synchronize
+	mutable std::array<SSlot, szSlots>	vmSlots;
+};
+
+size_t exEpoch::Pin() const
+{
+	//	the counter is raised before the caller loads the published state , so a writer that does not see the pin has already published
+	const size_t slot = GetSlot();
+	const size_t parity = mEpoch.load() & 1;
+	vmSlots[slot].vmPins[parity].fetch_add(1);
+
+	return slot << 1 | parity;
+}
+
+void exEpoch::Unpin(const size_t& token) const
+{
+	vmSlots[token >> 1].vmPins[token & 1].fetch_sub(1, std::memory_order_release);
+}
+
+void exEpoch::Synchronize()
+{
+	//	a reader may read the parity before the first flip & raise its counter after the first wait , the second flip & wait catch it
+	for (int flip = 0; flip < 2; flip++)
+	{
+		const size_t parity = mEpoch.fetch_add(1) & 1;
+		for (SSlot& slot : vmSlots)
+		{
+			while (slot.vmPins[parity].load())
+				std::this_thread::yield();
+		}
+	}
+}
@@ -0,0 +1,75 @@
+//	exMemory field sets | compile time lists of the struct members a partial read needs
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+//	byte range of a struct member
+typedef struct FIELDSPAN64
+{
+	size_t							offset{ 0 };						//	offset from the start of the struct
+	size_t							size{ 0 };							//	size in bytes
+} FIELDSPAN32, fieldSpan_t;
+
+/* declares a member of a struct for a field set , nested members are allowed
+* e.g. EX_FIELD(ACharacter, APawn.AActor.RootComponent)
+*/
+#define EX_FIELD(type, member) fieldSpan_t{ offsetof(type, member), sizeof(static_cast<type*>(nullptr)->member) }
+
+/*
+*	the minimal set of spans covering the requested members of T , built at compile time with exFields
+*	spans are sorted by offset & members closer than szMergeGap are merged into a single span
+*/
+template <typename T, size_t N>
+struct exFieldSet
+{
+	static constexpr size_t			szMergeGap = 0x20;					//	reading a small gap is cheaper than another request
+
+	std::array<fieldSpan_t, N>		spans{};							//	merged spans , first count entries are used
+	size_t							count{ 0 };							//	number of merged spans
+
+	/* returns the number of bytes read for one struct */
+	constexpr size_t GetSize() const
+	{
+		size_t result{ 0 };
+		for (size_t i = 0; i < count; i++)
+			result += spans[i].size;
+
+		return result;
+	}
+};
+
+/* builds a field set for T from EX_FIELD declarations
+* e.g. static constexpr auto fields = exFields<ACharacter>(EX_FIELD(ACharacter, Mesh), EX_FIELD(ACharacter, APawn.AActor.RootComponent));
+*/
+template <typename T, typename... Fields>
+constexpr exFieldSet<T, sizeof...(Fields)> exFields(const Fields&... fields)
+{
+	static_assert(sizeof...(Fields) > 0, "a field set needs at least one field");
+
+	std::array<fieldSpan_t, sizeof...(Fields)> sorted{ fields... };
+	std::sort(sorted.begin(), sorted.end(), [](const fieldSpan_t& a, const fieldSpan_t& b) { return a.offset < b.offset; });
+
+	exFieldSet<T, sizeof...(Fields)> result;
+	for (const fieldSpan_t& field : sorted)
+	{
+		if (field.offset + field.size > sizeof(T))
+			throw "field is outside of the struct";	//	not a constant expression , fails compilation
+
+		if (result.count)
+		{
+			fieldSpan_t& span = result.spans[result.count - 1];
+			const size_t end = span.offset + span.size;
+			if (field.offset <= end + exFieldSet<T, sizeof...(Fields)>::szMergeGap)
+			{
+				span.size = std::max(end, field.offset + field.size) - span.offset;
+				continue;
+			}
+		}
+
+		result.spans[result.count++] = field;
+	}
+
+	return result;
+}
@@ -1,19 +1,37 @@
 //	https://github.com/NightFyre/exMemory
 
 #pragma once
+#if defined(_WIN32)
 #include <windows.h>
 #include <TlHelp32.h>
 #include <Psapi.h>
+#endif
+#include <atomic>
+#include <cctype>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <vector>
 #include <string>
-
-//	architecture type helpers
-#ifdef _WIN64
-typedef unsigned __int64  i64_t;
-#else
-typedef unsigned int i64_t;
-#endif
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include "exArena.hpp"
+#include "exBackend.hpp"
+#include "exCache.hpp"
+#include "exChains.hpp"
+#include "exEpoch.hpp"
+#include "exFields.hpp"
+#include "exMetrics.hpp"
+#include "exMirror.hpp"
+#include "exNegative.hpp"
+#include "exPlanner.hpp"
+#include "exProfiler.hpp"
+#include "exRegions.hpp"
+#include "exScan.hpp"
+#include "exSchedule.hpp"
+#include "exSentinel.hpp"
+#include "exWrites.hpp"
 
 //	fwd declare helpers
 inline static std::string ToLower(const std::string& input);
@@ -40,7 +58,9 @@ typedef struct MODULEINFO64
 {
 	DWORD							dwPID{ 0 };							//	owning process id
 	i64_t							dwModuleBase{ 0 };					//	module base address in process
+	size_t							szModule{ 0 };						//	module size in bytes
 	std::string						mModName{ "" };						//	module name
+	std::string						mModPath{ "" };						//	module path
 } MODULEINFO32, modInfo_t;
 
 //	assembly opcode index
@@ -91,44 +111,234 @@ public:
 			INSTANCE MEMBERS
 	*/
 public:
-	bool						bAttached;	//	attached to a process
+	std::atomic<bool>			bAttached{ false };	//	attached to a process
 	double						mFrequency;	//	update frequency in ms
 
 private:
-	procInfo_t					vmProcess;	//	attached process information
+	/* attached process , its backend & the optional components , published as a whole & never changed once published , see AcquireState */
+	struct SState
+	{
+		procInfo_t					vmProcess;	//	attached process information , empty while detached
+		std::shared_ptr<exMemoryBackend>	vmBackend;	//	memory i/o for the attached process
+		std::shared_ptr<exPageCache>	vmReadCache;	//	optional page cache for reads , see SetReadCache
+		std::shared_ptr<exReadPlanner>	vmPlanner;	//	optional read coalescing , see SetReadCoalescing
+		std::shared_ptr<exRegionMap>	vmRegions;	//	optional region map for pointer checks , see SetRegionMap
+		std::shared_ptr<exNegativeCache>	vmNegative;	//	optional record of pages that failed to read , see SetNegativeCache
+		std::shared_ptr<exReadProfiler>	vmProfiler;	//	optional read log , see SetReadProfiler
+		std::shared_ptr<exReadMetrics>	vmMetrics;	//	optional per call site counters , see SetReadMetrics
+		std::shared_ptr<exMemoryMirror>	vmMirror;	//	optional background copies of hot ranges , see SetMirror
+	};
+
+private:
 	std::vector<procInfo_t>		vmProcList;	//	active process list
 	std::vector<modInfo_t>		vmModList;	//	module list for attached process
+	std::unordered_map<std::string, size_t>	vmModIndex;	//	lowercase module name -> index in vmModList
+	std::unordered_set<std::string>	vmModMisses;	//	lowercase module names not found since the last RefreshModules
+	mutable std::mutex			mModMutex;	//	guards the module table
+	std::atomic<SState*>		vmState{ new SState() };	//	published state , replaced by Attach , Detach , SetBackend & the Set* methods
+	exEpoch						mStateEpoch;	//	pins of the operations using the published state , see AcquireState
+	std::mutex					mStateMutex;	//	serializes the writers of vmState & guards vmRetiredCaches
+	std::vector<std::shared_ptr<exPageCache>>	vmRetiredCaches;	//	caches replaced by SetReadCache , kept for their views until NextGeneration
+	exReadArena					vmArena;	//	storage for views that are not served from the read cache , reset every generation
+	std::atomic<unsigned long long>	mGeneration{ 1 };	//	read generation , see NextGeneration
 
 	/*//--------------------------\\
 			INSTANCE METHODS
 	*/
 public:
 
-	/* attempts to attach to a process by name */
+	/* attempts to attach to a process by name
+	* installs an exWin32Backend on windows & an exLinuxBackend elsewhere , e.g. to read a game running under wine
+	*/
 	virtual inline bool Attach(const std::string& name, const DWORD& dwAccess = PROCESS_ALL_ACCESS);
 
+	/* attempts to attach to a process by id , same backends as Attach */
+	virtual inline bool AttachPID(const DWORD& dwPID, const DWORD& dwAccess = PROCESS_ALL_ACCESS);
+
 	/* detaches from the attached process */
 	virtual inline bool Detach();
 
-	/* verifies attached process is active & updates processinfo structure when needed */
+	/* verifies attached process is active & updates processinfo structure when needed
+	* detaches once the process has exited , cheap enough to call every tick , see exMemoryBackend::IsAlive
+	*/
 	virtual inline void update();
 
-	/* returns the process information structure
+	/* returns a copy of the process information structure , empty while detached
 	* see: procInfo_t or PROCESSINFO64
 	*/
-	inline const procInfo_t& GetProcessInfo() const { return vmProcess; }
+	inline procInfo_t GetProcessInfo() const { return AcquireState()->vmProcess; }
 
 	/* returns an updated process list */
 	inline const std::vector<procInfo_t>& GetProcessList() const { return vmProcList; }
 
-	/* returns a list containing all modules in the attached process */
-	inline const std::vector<modInfo_t>& GetModuleList() const { return vmModList; }
+	/* returns a copy of the module table of the attached process
+	* the table is built on attach & rebuilt by RefreshModules or a FindModule miss
+	*/
+	inline std::vector<modInfo_t> GetModuleList() const { std::lock_guard<std::mutex> lock(mModMutex); return vmModList; }
+
+	/* looks up a module of the attached process by name ( case insensitive ) in the module table
+	* a name that is not in the table rebuilds it once , so modules loaded since the last build are found
+	* a name that is still missing is remembered & fails without a rebuild until the next RefreshModules
+	* returns false if the module is not loaded
+	*/
+	inline bool FindModule(const std::string& modName, modInfo_t* lpResult);
+
+	/* rebuilds the module table of the attached process & forgets remembered misses , call after modules were loaded or unloaded */
+	inline bool RefreshModules();
+
+	/* returns the backend used for memory operations on the attached process */
+	inline std::shared_ptr<exMemoryBackend> GetBackend() const { return AcquireState()->vmBackend; }
+
+	/* replaces the backend used for memory operations
+	* Attach installs an exWin32Backend on the opened process handle , or an exLinuxBackend on the process id outside windows
+	*/
+	inline void SetBackend(const std::shared_ptr<exMemoryBackend>& backend);
+
+	/* enables or disables the page read cache
+	* while enabled each remote page is fetched at most once per generation , see NextGeneration
+	*/
+	inline void SetReadCache(const bool& bEnable);
+
+	/* returns true if reads are served through the page cache */
+	inline bool IsReadCacheEnabled() const { return AcquireState()->vmReadCache != nullptr; }
+
+	/* starts a new read generation , cached pages are refetched on their next use & views of earlier generations become invalid
+	* call once per update tick , operations in flight on other threads are not waited for
+	*/
+	inline void NextGeneration();
+
+	/* returns the current read generation */
+	inline unsigned long long GetGeneration() const { return mGeneration; }
+
+	/* enables or disables read prefetch , requires the read cache
+	* while enabled the pages read in a generation are recorded & fetched again in one batch by Prefetch
+	*/
+	inline void SetReadPrefetch(const bool& bEnable) { auto state = AcquireState(); if (state->vmReadCache) state->vmReadCache->SetPrefetch(bEnable); }
+
+	/* fetches the pages read in the previous generation in one batch , pages already read in this generation are skipped
+	* call after the latency critical reads of a tick & ahead of the bulk reads , which are then served locally while their pointers are unchanged
+	* returns the number of pages fetched
+	*/
+	inline size_t Prefetch();
+
+	/* returns the page cache counters ( hits , misses , bytes ) */
+	inline readCacheStats_t GetReadCacheStats() const { auto state = AcquireState(); return state->vmReadCache ? state->vmReadCache->GetStats() : readCacheStats_t(); }
+
+	/* enables or disables read coalescing for batches
+	* requests ( or missing cache pages ) within gap bytes of each other are fetched as one read & scattered back
+	*/
+	inline void SetReadCoalescing(const bool& bEnable, const size_t& gap = 0x100);
+
+	/* returns the read planner counters ( requests , spans , bytes ) */
+	inline readPlanStats_t GetReadPlanStats() const { auto state = AcquireState(); return state->vmPlanner ? state->vmPlanner->GetStats() : readPlanStats_t(); }
+
+	/* enables or disables the region map used by IsReadable
+	* enabling builds the map from every readable region of the attached process
+	*/
+	inline void SetRegionMap(const bool& bEnable);
+
+	/* returns false if the range is known to be unmapped or unreadable in the attached process
+	* answered from the region map without touching the target , unknown ranges are queried once
+	* returns true for any range if the region map is disabled
+	*/
+	inline bool IsReadable(const i64_t& addr, const size_t& size);
+
+	/* returns the region map counters ( lookups , rejected , queries ) */
+	inline regionMapStats_t GetRegionMapStats() const { auto state = AcquireState(); return state->vmRegions ? state->vmRegions->GetStats() : regionMapStats_t(); }
+
+	/* enables or disables the negative cache
+	* while enabled a page that failed to read is failed locally for expiry generations , e.g. the mesh of a destroyed actor
+	*/
+	inline void SetNegativeCache(const bool& bEnable, const unsigned long long& expiry = 16);
+
+	/* returns the negative cache counters ( avoided reads , recorded & expired pages ) */
+	inline negativeCacheStats_t GetNegativeCacheStats() const { auto state = AcquireState(); return state->vmNegative ? state->vmNegative->GetStats() : negativeCacheStats_t(); }
+
+	/* enables or disables the memory mirror , a background thread that re-reads registered ranges every interval
+	* see: exMemoryMirror::Register , Read & GetDirty
+	*/
+	inline void SetMirror(const bool& bEnable, const std::chrono::milliseconds& interval = std::chrono::milliseconds(4));
+
+	/* returns the memory mirror or nullptr if it is disabled , a mirror replaced by SetMirror is stopped & keeps its last copies */
+	inline std::shared_ptr<exMemoryMirror> GetMirror() const { return AcquireState()->vmMirror; }
+
+	/* enables or disables the read profiler
+	* while enabled every read is logged with its exReadTag , address , size & generation
+	*/
+	inline void SetReadProfiler(const bool& bEnable);
+
+	/* returns the read profiler or nullptr if it is disabled , a profiler replaced by SetReadProfiler keeps its log but records no more reads
+	* see exReadProfiler::GetReport , ExportCSV & ExportJSON
+	*/
+	inline std::shared_ptr<exReadProfiler> GetReadProfiler() const { return AcquireState()->vmProfiler; }
+
+	/* enables or disables read metrics
+	* while enabled every read call adds its syscalls , bytes , failures & latency to the counters of its exReadTag
+	*/
+	inline void SetReadMetrics(const bool& bEnable);
+
+	/* returns the counters of every call site , descending by time spent , empty if metrics are disabled */
+	inline std::vector<readMetric_t> GetReadMetrics() const { auto state = AcquireState(); return state->vmMetrics ? state->vmMetrics->GetMetrics() : std::vector<readMetric_t>(); }
+
+	/* drops the read metrics counters */
+	inline void ClearReadMetrics() { auto state = AcquireState(); if (state->vmMetrics) state->vmMetrics->Clear(); }
 
 
 private:
 
 	/* helper method to determine if the current memory instance is attached to a process for handling various memory operations */
-	inline const bool IsValidInstance() noexcept { return bAttached && vmProcess.bAttached && vmProcess.hProc != INVALID_HANDLE_VALUE; }
+	inline const bool IsValidInstance() noexcept { return bAttached && AcquireState()->vmBackend != nullptr; }
+
+	/* pin on the published state for the length of one operation , see AcquireState */
+	class SStateLease
+	{
+	public:
+		inline SStateLease(const exEpoch& epoch, const std::atomic<SState*>& state) : pEpoch(&epoch), mToken(epoch.Pin()), pState(state.load()) {}
+		inline ~SStateLease() noexcept { pEpoch->Unpin(mToken); }
+		SStateLease(const SStateLease&) = delete;
+		SStateLease& operator=(const SStateLease&) = delete;
+
+		inline const SState* operator->() const { return pState; }
+		inline const SState& operator*() const { return *pState; }
+
+	private:
+		const exEpoch*				pEpoch;
+		size_t						mToken;
+		const SState*				pState;
+	};
+
+	/* pins mStateEpoch & returns the published state , which is not changed or freed while the lease is held
+	* a read costs two atomic adds on a cache line of its own thread , no lock & no reference count
+	* Attach , Detach , SetBackend & the Set* methods publish a new state & wait for the leases on the old one before freeing it
+	* leases may nest , but a thread holding one must not call a method that publishes
+	*/
+	inline SStateLease AcquireState() const { return SStateLease(mStateEpoch, vmState); }
+
+	/* replaces the published state & frees the old one once no lease holds it , mStateMutex must be held */
+	inline void PublishState(const SState& state);
+
+	/* returns a pointer into the read cache for a range inside one fresh page or nullptr , see exPageCache::View */
+	inline const void* ViewMemory(const i64_t& addr, const size_t& szRead, const size_t& align);
+
+	/* records the pages of a failed read in the negative cache
+	* a read inside one page records that page , larger reads up to szMaxProbe are split into pages once to find the unreadable ones
+	*/
+	inline void RecordFailure(const SState& state, const i64_t& addr, const size_t& szRead);
+
+	/* reads a range page by page through the read cache or the backend & records its unreadable pages , see ReadMemoryPartial */
+	inline size_t ReadPartialRange(const SState& state, const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask);
+	static constexpr size_t			szMaxProbe = 0x4000;	//	largest failed read split to find its unreadable pages
+
+	/* replaces the attached process & its backend , shared by Attach & AttachPID */
+	inline bool AttachBackend(const procInfo_t& proc, const std::shared_ptr<exMemoryBackend>& backend);
+
+#if defined(_WIN32)
+	/* returns the process handle of a win32 backend or INVALID_HANDLE_VALUE , the handle lives as long as the backend reference */
+	static inline HANDLE GetBackendHandle(exMemoryBackend* backend) { auto win32 = dynamic_cast<exWin32Backend*>(backend); return win32 ? win32->GetHandle() : INVALID_HANDLE_VALUE; }
+#else
+	/* returns the process id of a linux backend or 0 */
+	static inline pid_t GetBackendPID(exMemoryBackend* backend) { auto native = dynamic_cast<exLinuxBackend*>(backend); return native ? native->GetPID() : 0; }
+#endif
 
 
 public:
@@ -138,34 +348,80 @@ public:
 	*/
 	inline bool ReadMemory(const i64_t& addr, void* buffer, const DWORD& szRead);
 
+	/* reads a list of requests in the attached process as a single submission
+	* sets bSuccess on each request & returns the number of requests that were read completely
+	*/
+	inline size_t ReadMemoryBatch(readRequest_t* requests, const size_t& count);
+	inline size_t ReadMemoryBatch(std::vector<readRequest_t>& requests) { return ReadMemoryBatch(requests.data(), requests.size()); }
+
+	/* reads as much of a range as possible in the attached process , unreadable pages are zeroed & skipped
+	* pageMask ( optional ) receives one entry per page touched by the range , true if that part of the page was read
+	* pages in the negative cache are zeroed without a read , only the runs of pages between them reach the target
+	* returns the number of bytes copied
+	*/
+	inline size_t ReadMemoryPartial(const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask = nullptr);
+
 	/* attempts to write bytes in the attached process
 	* returns true if all bytes were written successfully
 	*/
 	inline bool WriteMemory(const i64_t& addr, const void* buffer, const DWORD& szWrite);
 
+	/* writes a list of requests in the attached process as a single submission
+	* sets bSuccess on each request & returns the number of requests that were written completely
+	*/
+	inline size_t WriteMemoryBatch(writeRequest_t* requests, const size_t& count);
+	inline size_t WriteMemoryBatch(exWriteBatch& batch) { auto requests = batch.Build(); return WriteMemoryBatch(requests.data(), requests.size()); }
+
 	/* reads a continguous string in at the specified address in the attached process
 	* returns true if the string was successfully read
 	*/
 	inline bool ReadString(const i64_t& addr, std::string& string, const DWORD& szString = MAX_PATH);
 
+	/* reads count single byte characters into the per generation arena , the view ends at the first null character
+	* returns an empty view if the read failed , valid until the next NextGeneration
+	*/
+	inline std::string_view ReadStringView(const i64_t& addr, const size_t& count);
+
+	/* reads exactly count utf-16 units ( e.g. FString data ) & converts them to utf-8 in the per generation arena
+	* returns an empty view if the read failed , valid until the next NextGeneration
+	*/
+	inline std::string_view ReadWideString(const i64_t& addr, const size_t& count);
+
 	/* reads a chain of pointers in the attached process to find an address in memory
 	* returns the address if found
 	*/
 	inline i64_t ReadPointerChain(const i64_t& addr, std::vector<unsigned int>& offsets, i64_t* lpResult);
 
+	/* resolves a cached pointer chain in the attached process
+	* within a generation the cached result is returned , otherwise every cached link is checked in one batch & only changed links are walked again
+	* returns the resolved address or 0 if a link is null
+	*/
+	inline i64_t ResolvePointerChain(exPointerChain& chain);
+
+	/* reads every sentinel in one batch & compares it with its previous bytes , see exSentinel::IsChanged
+	* returns the number of sentinels that changed
+	*/
+	inline size_t CheckSentinels(std::span<exSentinel* const> sentinels);
+
 	/* attempts to patch a sequence of bytes in the attached process
 	* returns true if successful
 	*/
 	inline bool PatchMemory(const i64_t& addr, const void* buffer, const DWORD& szWrite);
 
+	/* patches a list of requests in the attached process , protection is changed once per region of pages for the whole batch
+	* sets bSuccess on each request & returns the number of requests that were written completely
+	*/
+	inline size_t PatchMemoryBatch(writeRequest_t* requests, const size_t& count);
+	inline size_t PatchMemoryBatch(exWriteBatch& batch) { auto requests = batch.Build(); return PatchMemoryBatch(requests.data(), requests.size()); }
+
 	/* gets an address relative to the input named module base address */
 	inline i64_t GetAddress(const unsigned int& offset, const std::string& modName = "");
 	inline bool GetAddress(const unsigned int& offset, i64_t* lpResult, const std::string& modName = "");
 
-	/* attempts to find a pattern in the attached process
+	/* attempts to find a pattern in the attached process , in the main module or the named module
 	* returns the address of pattern if found
 	*/
-	inline i64_t FindPattern(const std::string& signature, i64_t* result, int padding = 0, bool isRelative = false, EASM instruction = EASM::ASM_NULL);
+	inline i64_t FindPattern(const std::string& signature, i64_t* result, int padding = 0, bool isRelative = false, EASM instruction = EASM::ASM_NULL, const std::string& modName = "");
 
 	/* attempts to find a section header address in the attached process*/
 	inline i64_t GetSectionHeader(const ESECTIONHEADERS& section, i64_t* lpResult);
@@ -173,8 +429,10 @@ public:
 	/* attempts to obtain the address of a function located in the atteched processes export directory */
 	inline i64_t GetProcAddress(const std::string& fnName, i64_t* lpResult);
 
+#if defined(_WIN32)
 	/* attempts to inject a module from disk into the attached process */
 	inline bool LoadLibraryInject(const std::string& dllPath);
+#endif
 
 
 public:
@@ -201,6 +459,124 @@ public:
 		return result;
 	}
 
+	/* template partial read , only the members in the field set are read & all other members are value initialized
+	* see: exFields & EX_FIELD
+	*/
+	template<typename T, size_t N>
+	auto Read(i64_t addr, const exFieldSet<T, N>& fields) noexcept -> T
+	{
+		T result{};
+		ReadFields(addr, &result, fields);
+		return result;
+	}
+
+	/* template partial read into an existing structure , members outside the field set are left untouched
+	* returns true if every span was read
+	*/
+	template<typename T, size_t N>
+	auto ReadFields(i64_t addr, T* out, const exFieldSet<T, N>& fields) noexcept -> bool
+	{
+		std::array<readRequest_t, N> requests;
+		for (size_t i = 0; i < fields.count; i++)
+			requests[i] = { addr + fields.spans[i].offset, reinterpret_cast<unsigned char*>(out) + fields.spans[i].offset, fields.spans[i].size };
+
+		return ReadMemoryBatch(requests.data(), fields.count) == fields.count;
+	}
+
+	/* template helper that appends one request per span of the field set
+	* used to read the same members of many structures in a single batch , see ReadMemoryBatch
+	*/
+	template<typename T, size_t N>
+	static auto PushFieldReads(std::vector<readRequest_t>& requests, i64_t addr, T* out, const exFieldSet<T, N>& fields) -> void
+	{
+		for (size_t i = 0; i < fields.count; i++)
+			requests.push_back({ addr + fields.spans[i].offset, reinterpret_cast<unsigned char*>(out) + fields.spans[i].offset, fields.spans[i].size });
+	}
+
+	/* template view read , returns a read only view of the structure instead of a copy
+	* points into the read cache when the structure lies in one cached page , otherwise the structure is read into the per generation arena
+	* the view is valid until the next NextGeneration , an empty view means the read failed
+	*/
+	template<typename T>
+	auto View(i64_t addr) noexcept -> exRemoteView<T>
+	{
+		const void* data = ViewMemory(addr, sizeof(T), alignof(T));
+		if (!data)
+		{
+			void* copy = vmArena.Allocate(sizeof(T), alignof(T));
+			if (!ReadMemory(addr, copy, sizeof(T)))
+				return {};
+
+			data = copy;
+		}
+
+		return { static_cast<const T*>(data), mGeneration };
+	}
+
+	/* template partial view read , only the members in the field set are guaranteed to be read & arena copies value initialize the rest
+	* a view served from the read cache exposes the whole structure
+	*/
+	template<typename T, size_t N>
+	auto View(i64_t addr, const exFieldSet<T, N>& fields) noexcept -> exRemoteView<T>
+	{
+		const void* data = ViewMemory(addr, sizeof(T), alignof(T));
+		if (!data)
+		{
+			void* copy = vmArena.Allocate(sizeof(T), alignof(T));
+			if (!ReadFields(addr, static_cast<T*>(copy), fields))
+				return {};
+
+			data = copy;
+		}
+
+		return { static_cast<const T*>(data), mGeneration };
+	}
+
+	/* template array view read , same lifetime rules as View
+	* returns an empty span if the array could not be read
+	*/
+	template<typename T>
+	auto ViewArray(i64_t addr, const size_t& count) noexcept -> std::span<const T>
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "remote views need trivially copyable types");
+		if (!count)
+			return {};
+
+		const void* data = ViewMemory(addr, count * sizeof(T), alignof(T));
+		if (!data)
+		{
+			void* copy = vmArena.Allocate(count * sizeof(T), alignof(T));
+			if (!ReadMemory(addr, copy, static_cast<DWORD>(count * sizeof(T))))
+				return {};
+
+			data = copy;
+		}
+
+		return { static_cast<const T*>(data), count };
+	}
+
+	/* template array read into a caller provided span , the whole array is read at once
+	* returns true if every element was read
+	*/
+	template<typename T>
+	auto ReadArray(i64_t addr, std::span<T> out) noexcept -> bool
+	{
+		if (out.empty())
+			return true;
+
+		return ReadMemory(addr, out.data(), static_cast<DWORD>(out.size_bytes()));
+	}
+
+	/* template array read into a reusable buffer , the buffer is resized to count & keeps its capacity between calls
+	* returns true if every element was read
+	*/
+	template<typename T>
+	auto ReadArray(i64_t addr, std::vector<T>& out, const size_t& count) -> bool
+	{
+		out.resize(count);
+		return ReadArray(addr, std::span<T>(out));
+	}
+
 	/* template write memory with szPatch param */
 	template<typename T>
 	auto Write(i64_t addr, T patch, DWORD szPatch) noexcept -> bool { return WriteMemory(addr, &patch, szPatch); }
@@ -226,49 +602,63 @@ public:	//	methods for directly attaching to a process
 public:	//	methods for retrieving information on a process by name , are somewhat slow and should not be used constantly. consider caching information if needed.
 
 	/* attempts to retrieve a process id by name
-	* utilizes FindProcessEx which iterates through ALL processes information before again searching through the procInfo list to return a match ( if any )
+	* utilizes FindProcessEx which filters processes by name before taking module snapshots of the matches
 	*/
 	static inline bool GetProcID(const std::string& procName, DWORD* outPID);
 
 	/* attempts to obtain the module base address for the specified process name
-	* utilizes FindProcessEx which iterates through ALL processes information before again searching through the procInfo list to return a match ( if any )
+	* utilizes FindProcessEx which filters processes by name before taking module snapshots of the matches
 	*/
 	static inline bool GetModuleBaseAddress(const std::string& procName, i64_t* lpResult, const std::string& modName = "");
 
 	/* attempts to obtain information on a process without opening a handle to it
-	* utilizes FindProcessEx which iterates through ALL processes information before again searching through the procInfo list to return a match ( if any )
+	* utilizes FindProcessEx which filters processes by name before taking module snapshots of the matches
 	*/
 	static inline bool GetProcInfo(const std::string& name, procInfo_t* lpout);
 
 	/* determines if the specified name exists in the active process directory
-	* utilizes FindProcessEx which iterates through ALL processes information before again searching through the procInfo list to return a match ( if any )
+	* utilizes FindProcessEx which filters processes by name before taking module snapshots of the matches
 	*/
 	static inline bool IsProcessRunning(const std::string& name);
 
 
 public:	//	methods for obtaining info on active processes
 
-	/* obtains a list of all active processes on the machine that contains basic information on a process without requiring a handle
+	/* obtains a list of active processes on the machine that contains basic information on a process without requiring a handle
+	* processes are filtered by executable name first ( case insensitive , empty for all ) , module base & path are only resolved for the matches
 	* ref: https://learn.microsoft.com/en-us/windows/win32/toolhelp/taking-a-snapshot-and-viewing-processes
 	*/
-	static inline bool GetActiveProcessesEx(std::vector<procInfo_t>& procList);
+	static inline bool GetActiveProcessesEx(std::vector<procInfo_t>& procList, const std::string& procName = "");
 
-	/* obtains a list of all modules loaded in the attached process */
+	/* obtains a list of all modules loaded in the attached process
+	* outside windows every file mapped by the process is a module , from its first to its last mapping
+	*/
 	static inline bool GetProcessModulesEx(const DWORD& dwPID, std::vector< modInfo_t>& moduleList);
 
 	/* gets info on a process by name , can be extended to attach to the process if found
-	* utilizes GetActiveProcesses method which is somewhat slow as it obtains ALL processes before returning
+	* utilizes GetActiveProcessesEx filtered by name , only matching processes are snapshotted
 	*/
 	static inline bool FindProcessEx(const std::string& procName, procInfo_t* procInfo, const bool& bAttach, const DWORD& dwDesiredAccess);
 
 	/* attempts to find a module by name located in the attached process and returns it's base address */
 	static inline bool FindModuleEx(const std::string& procName, const std::string& modName, modInfo_t* lpResult);
 
+#if defined(_WIN32)
 public:	//	basic memory operations
 
 	/* attempts to read memory at the specified address from the target process */
 	static inline bool ReadMemoryEx(const HANDLE& hProc, const i64_t& addr, void* buffer, size_t szRead);
 
+	/* attempts to read a list of requests from the target process
+	* the destination of a failed request is zeroed , matching the result of ReadEx<T>
+	*/
+	static inline size_t ReadMemoryBatchEx(const HANDLE& hProc, readRequest_t* requests, const size_t& count);
+
+	/* attempts to read as much of a range as possible from the target process , unreadable pages are zeroed & skipped
+	* returns the number of bytes copied , see exMemoryBackend::ReadMemoryPartial
+	*/
+	static inline size_t ReadMemoryPartialEx(const HANDLE& hProc, const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask = nullptr);
+
 	/* attempts to write bytes to the specified address in memory from the target process */
 	static inline bool WriteMemoryEx(const HANDLE& hProc, const i64_t& addr, LPVOID buffer, DWORD szWrite);
 
@@ -281,10 +671,31 @@ public:	//	basic memory operations
 	/* attempts to patch a sequence of bytes in the target process */
 	static inline bool PatchMemoryEx(const HANDLE& hProc, const i64_t& addr, const void* buffer, const DWORD& szWrite);
 
+	/* attempts to patch a list of requests in the target process
+	* the pages of all requests are queried once , pages that are not writable have their protection changed once & restored after every write
+	* returns the number of requests that were written completely
+	*/
+	static inline size_t PatchMemoryBatchEx(const HANDLE& hProc, writeRequest_t* requests, const size_t& count);
+#else
+public:	//	basic memory operations
+
+	/* attempts to patch a list of requests in the target process through /proc/<pid>/mem , which writes read only pages like a debugger
+	* returns the number of requests that were written completely
+	*/
+	static inline size_t PatchMemoryBatchEx(const pid_t& pid, writeRequest_t* requests, const size_t& count);
+#endif
+
+	/* converts count utf-16 units to utf-8 , out must hold count * 3 bytes
+	* unpaired surrogates become U+FFFD , returns the number of bytes written
+	*/
+	static inline size_t Utf16ToUtf8(const char16_t* src, const size_t& count, char* out);
+
 public:	//	advanced methods for obtaining information on a process which requires a handle
 
+#if defined(_WIN32)
 	/* attempts to find a module by name located in the attached process and returns it's base address */
 	static inline bool GetModuleAddressEx(const HANDLE& hProc, const std::string& moduleName, i64_t* lpResult);
+#endif
 
 	/* attempts to return the address of a section header by index
 	* ref: https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-image_nt_headers64
@@ -292,22 +703,32 @@ public:	//	advanced methods for obtaining information on a process which require
 	* ref: https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-image_optional_header64
 	* ref: https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-image_section_header
 	*/
+#if defined(_WIN32)
 	static inline bool GetSectionHeaderAddressEx(const HANDLE& hProc, const std::string& moduleName, const ESECTIONHEADERS& section, i64_t* lpResult, size_t* szImage);
 	static inline bool GetSectionHeaderAddressEx(const HANDLE& hProc, const i64_t& dwModule, const ESECTIONHEADERS& section, i64_t* lpResult, size_t* szImage);
+#endif
+	static inline bool GetSectionHeaderAddressEx(exMemoryBackend& backend, const i64_t& dwModule, const ESECTIONHEADERS& section, i64_t* lpResult, size_t* szImage);
 
 	/* attempts to return an address located in memory via pattern scan. can be extended to extract bytes from an instruction
 	* modifed version of -> https://www.unknowncheats.me/forum/3019469-post2.html
 	*/
+#if defined(_WIN32)
 	static inline bool FindPatternEx(const HANDLE& hProc, const std::string& moduleName, const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction);
 	static inline bool FindPatternEx(const HANDLE& hProc, const i64_t& dwModule, const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction);
+#endif
+	static inline bool FindPatternEx(exMemoryBackend& backend, const i64_t& dwModule, const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction);
 
 	/* attempts to find an exported function by name and return the it's rva
 	* https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-image_data_directory
 	*/
+#if defined(_WIN32)
 	static inline bool GetProcAddressEx(const HANDLE& hProc, const std::string& moduleName, const std::string& fnName, i64_t* lpResult);
 	static inline bool GetProcAddressEx(const HANDLE& hProc, const i64_t& dwModule, const std::string& fnName, i64_t* lpResult);
+#endif
+	static inline bool GetProcAddressEx(exMemoryBackend& backend, const i64_t& dwModule, const std::string& fnName, i64_t* lpResult);
 
 
+#if defined(_WIN32)
 public:	//	injection operations 
 
 	/* injects a module (from disk) into the target process using LoadLibrary */
@@ -358,6 +779,90 @@ private://	tools
 	* ref: https://learn.microsoft.com/en-us/windows/win32/api/winuser/nf-winuser-enumwindows
 	*/
 	static inline BOOL CALLBACK GetProcWindowEx(HWND handle, LPARAM lParam);
+#endif
+};
+
+/*
+*	forward iterator over an array in the attached process
+*	elements are read szChunk at a time into two fixed buffers , a miss reads the chunk & the chunk after it in one batch
+*	so a sequential walk issues one batch per two chunks , no heap allocations , elements of a chunk that could not be read are value initialized
+*	e.g. for (const i64_t& pActor : exRemoteArray<i64_t, 512>(g_memory, actors.data, actors.count))
+*/
+template<typename T, size_t szChunk = 64>
+class exRemoteArray
+{
+public:
+	explicit exRemoteArray(exMemory& memory, const i64_t& addr, const size_t& count) : pMemory(&memory), mAddr(addr), mCount(count) {}
+
+	class iterator
+	{
+	public:
+		iterator(exRemoteArray* owner, const size_t& index) : pOwner(owner), mIndex(index) {}
+
+		const T& operator*() const { return pOwner->At(mIndex); }
+		const T* operator->() const { return &pOwner->At(mIndex); }
+		iterator& operator++() { mIndex++; return *this; }
+		bool operator==(const iterator& other) const { return mIndex == other.mIndex; }
+		bool operator!=(const iterator& other) const { return mIndex != other.mIndex; }
+
+		/* returns the element index in the remote array */
+		size_t GetIndex() const { return mIndex; }
+
+	private:
+		exRemoteArray*				pOwner;
+		size_t						mIndex;
+	};
+
+	iterator begin() { return iterator(this, 0); }
+	iterator end() { return iterator(this, mCount); }
+	size_t size() const { return mCount; }
+
+	/* returns the element at index , fetching its chunk if neither buffer holds it */
+	const T& At(const size_t& index)
+	{
+		const size_t chunk = index / szChunk;
+		if (chunk == vmChunk[1])
+			return vmBuffer[1][index % szChunk];
+
+		if (chunk != vmChunk[0])
+			Fetch(chunk);
+
+		return vmBuffer[0][index % szChunk];
+	}
+
+private:
+
+	/* reads a chunk into the first buffer & the next chunk ahead into the second , one batch */
+	void Fetch(const size_t& chunk)
+	{
+		std::array<readRequest_t, 2> requests;
+		std::array<size_t, 2> counts{};
+		size_t nRequests{ 0 };
+		for (size_t i = 0; i < 2; i++)
+		{
+			const size_t first = (chunk + i) * szChunk;
+			vmChunk[i] = first < mCount ? chunk + i : size_t(-1);
+			if (first >= mCount)
+				continue;
+
+			counts[i] = std::min(szChunk, mCount - first);
+			requests[nRequests++] = { mAddr + first * sizeof(T), vmBuffer[i].data(), counts[i] * sizeof(T) };
+		}
+
+		pMemory->ReadMemoryBatch(requests.data(), nRequests);
+		for (size_t i = 0; i < nRequests; i++)
+		{
+			if (!requests[i].bSuccess)
+				std::fill_n(vmBuffer[i].begin(), counts[i], T{});
+		}
+	}
+
+private:
+	exMemory*						pMemory;
+	i64_t							mAddr{ 0 };							//	address of the first element
+	size_t							mCount{ 0 };						//	number of elements
+	std::array<size_t, 2>			vmChunk{ size_t(-1), size_t(-1) };	//	chunk held in each buffer
+	std::array<std::array<T, szChunk>, 2>	vmBuffer{};					//	current chunk & the chunk read ahead
 };
 
 
@@ -380,6 +885,7 @@ exMemory::exMemory(const std::string& name, const DWORD& dwAccess)
 exMemory::~exMemory()
 {
 	Detach();	//	close handles and free resources
+	delete vmState.load();
 }
 
 
@@ -393,25 +899,227 @@ exMemory::~exMemory()
 bool exMemory::Attach(const std::string& name, const DWORD& dwAccess)
 {
 	procInfo_t proc;
-	if (!AttachEx(name, &proc, dwAccess))
+	if (!AttachEx(name, &proc, dwAccess) || !proc.bAttached)
+		return false;
+
+#if defined(_WIN32)
+	//	the backend owns the handle & closes it once the last reference is released
+	return AttachBackend(proc, std::make_shared<exWin32Backend>(proc.hProc, true));
+#else
+	return AttachBackend(proc, std::make_shared<exLinuxBackend>(pid_t(proc.dwPID)));
+#endif
+}
+
+bool exMemory::AttachPID(const DWORD& dwPID, const DWORD& dwAccess)
+{
+	procInfo_t proc;
+#if defined(_WIN32)
+	//	the first module of the process is the executable
+	std::vector<modInfo_t> mods;
+	if (!GetProcessModulesEx(dwPID, mods))
+		return false;
+
+	proc.dwPID = dwPID;
+	proc.dwModuleBase = mods.front().dwModuleBase;
+	proc.mProcName = mods.front().mModName;
+	proc.mProcPath = mods.front().mModPath;
+	proc.dwAccessLevel = dwAccess;
+
+	EnumWindowData eDat;
+	eDat.procId = proc.dwPID;
+	eDat.hwnd = 0;
+	if (EnumWindows(GetProcWindowEx, reinterpret_cast<LPARAM>(&eDat)))
+		proc.hWnd = eDat.hwnd;
+
+	char buffer[MAX_PATH];
+	if (proc.hWnd && GetWindowTextA(proc.hWnd, buffer, MAX_PATH))
+		proc.mWndwTitle = std::string(buffer);
+
+	proc.hProc = OpenProcess(dwAccess, false, dwPID);
+	if (!proc.hProc || proc.hProc == INVALID_HANDLE_VALUE)
 		return false;
 
-	vmProcess = proc;
+	proc.bAttached = true;
 
-	return vmProcess.bAttached;
+	return AttachBackend(proc, std::make_shared<exWin32Backend>(proc.hProc, true));
+#else
+	linuxProcInfo_t linuxProc;
+	if (!exLinuxBackend::FindProcessEx(pid_t(dwPID), &linuxProc))
+		return false;
+
+	proc.dwPID = dwPID;
+	proc.dwModuleBase = linuxProc.dwModuleBase;
+	proc.mProcName = linuxProc.mProcName;
+	proc.mProcPath = linuxProc.mProcPath;
+	proc.dwAccessLevel = dwAccess;
+
+	//	there is no handle to open , access is checked by reading the executable's first page
+	auto backend = std::make_shared<exLinuxBackend>(pid_t(dwPID));
+	unsigned char probe{ 0 };
+	proc.bAttached = !proc.dwModuleBase || backend->ReadMemory(proc.dwModuleBase, &probe, sizeof(probe));
+	if (!proc.bAttached)
+		return false;
+
+	return AttachBackend(proc, backend);
+#endif
+}
+
+bool exMemory::AttachBackend(const procInfo_t& proc, const std::shared_ptr<exMemoryBackend>& backend)
+{
+	Detach();	//	release any previous process
+
+	{
+		std::lock_guard<std::mutex> lock(mStateMutex);
+		SState state = *vmState.load();
+		state.vmProcess = proc;
+		PublishState(state);
+	}
+
+	SetBackend(backend);
+	RefreshModules();
+
+	return proc.bAttached;
 }
 
 bool exMemory::Detach()
 {
-	return DetachEx(vmProcess);
+	//	waits for in-flight operations , the backend closes its handle when the replaced state releases it
+	{
+		std::lock_guard<std::mutex> lock(mStateMutex);
+		bAttached = false;
+		SState state = *vmState.load();
+		state.vmBackend = nullptr;
+		state.vmProcess = procInfo_t();
+		PublishState(state);
+
+		//	operations fail without a backend , nothing reads the components while they are reset
+		if (state.vmRegions)
+			state.vmRegions->Clear();
+
+		if (state.vmMirror)
+			state.vmMirror->Stop();
+	}
+
+	std::lock_guard<std::mutex> lock(mModMutex);
+	vmModList.clear();
+	vmModIndex.clear();
+	vmModMisses.clear();
+
+	return true;
+}
+
+void exMemory::SetBackend(const std::shared_ptr<exMemoryBackend>& backend)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	state.vmBackend = backend;
+
+	//	the components that remember remote memory are left out while they are reset , so no operation mixes the old & the new target
+	SState reset = state;
+	reset.vmReadCache = nullptr;
+	reset.vmNegative = nullptr;
+	reset.vmRegions = nullptr;
+	PublishState(reset);
+
+	if (state.vmReadCache)
+		state.vmReadCache->Clear();
+
+	if (state.vmNegative)
+		state.vmNegative->Clear();
+
+	if (state.vmRegions)
+	{
+		state.vmRegions->Clear();
+		if (backend)
+			state.vmRegions->Refresh(*backend);
+	}
+
+	if (state.vmMirror)
+		state.vmMirror->Start(backend);
+
+	PublishState(state);
+	bAttached = backend != nullptr;
+}
+
+void exMemory::PublishState(const SState& state)
+{
+	SState* prev = vmState.exchange(new SState(state));
+	mStateEpoch.Synchronize();
+	delete prev;
+}
+
+void exMemory::SetReadCache(const bool& bEnable)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	if (state.vmReadCache)
+		vmRetiredCaches.push_back(state.vmReadCache);
+
+	state.vmReadCache = bEnable ? std::make_shared<exPageCache>() : nullptr;
+	if (state.vmReadCache && state.vmPlanner)
+		state.vmReadCache->SetCoalesceGap(state.vmPlanner->GetGap());
+
+	PublishState(state);
+}
+
+void exMemory::NextGeneration()
+{
+	mGeneration++;
+	vmArena.Reset();
+	{
+		//	no lease holds a retired cache , only views into its pages were left
+		std::lock_guard<std::mutex> lock(mStateMutex);
+		vmRetiredCaches.clear();
+	}
+
+	auto state = AcquireState();
+	if (state->vmBackend)
+		state->vmBackend->NextGeneration();
+
+	if (state->vmReadCache)
+		state->vmReadCache->NextGeneration();
+
+	if (state->vmRegions)
+		state->vmRegions->NextGeneration();
+
+	if (state->vmNegative)
+		state->vmNegative->NextGeneration(mGeneration);
+}
+
+void exMemory::SetNegativeCache(const bool& bEnable, const unsigned long long& expiry)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	state.vmNegative = bEnable ? std::make_shared<exNegativeCache>(expiry) : nullptr;
+	PublishState(state);
+}
+
+void exMemory::SetReadProfiler(const bool& bEnable)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	state.vmProfiler = bEnable ? std::make_shared<exReadProfiler>() : nullptr;
+	PublishState(state);
+}
+
+void exMemory::SetReadMetrics(const bool& bEnable)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	state.vmMetrics = bEnable ? std::make_shared<exReadMetrics>() : nullptr;
+	PublishState(state);
 }
 
 void exMemory::update()
 {
-	const bool& bAttched = vmProcess.bAttached;	//	is instance attached to a process ?
+	//	check if attached process is running , asked of the backend's process handle instead of enumerating every process
+	bool bAlive{ false };
+	{
+		auto state = AcquireState();
+		bAlive = state->vmBackend && state->vmBackend->IsAlive();
+	}
 
-	//	check if attached process is running
-	if (!IsProcessRunning(vmProcess.mProcName))
+	if (!bAlive)
 	{
 		Detach();	//	close handles and free resources if not already done ( safe to call multiple times if nothing is attached )
 		return;
@@ -429,10 +1137,340 @@ void exMemory::update()
 
 bool exMemory::ReadMemory(const i64_t& addr, void* buffer, const DWORD& szRead)
 {
-	if (!IsValidInstance())
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
+		return false;
+
+	if (state->vmProfiler)
+		state->vmProfiler->Record(addr, szRead, mGeneration);
+
+	exReadTimer timer(state->vmMetrics.get());
+	if (state->vmNegative && state->vmNegative->Reject(addr, szRead, mGeneration))
+	{
+		memset(buffer, 0, szRead);
+		timer.Stop(szRead, 1);
+		return false;
+	}
+
+	const bool result = state->vmReadCache ? state->vmReadCache->Read(*backend, addr, buffer, szRead) : backend->ReadMemory(addr, buffer, szRead);
+	timer.Stop(szRead, !result);
+
+	if (!result)
+		RecordFailure(*state, addr, szRead);
+	else if (state->vmRegions)
+		state->vmRegions->Forget(addr, szRead);
+
+	return result;
+}
+
+size_t exMemory::ReadMemoryBatch(readRequest_t* requests, const size_t& count)
+{
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
+	{
+		for (size_t i = 0; i < count; i++)
+			requests[i].bSuccess = false;
+
+		return 0;
+	}
+
+	if (state->vmProfiler)
+	{
+		for (size_t i = 0; i < count; i++)
+			state->vmProfiler->Record(requests[i].addr, requests[i].szRead, mGeneration);
+	}
+
+	exReadTimer timer(state->vmMetrics.get());
+
+	//	requests on pages that failed recently are failed locally , the rest go to the target
+	thread_local std::vector<readRequest_t> vmSubmit;
+	thread_local std::vector<size_t> vmSubmitIndex;
+	readRequest_t* submit = requests;
+	size_t nSubmit = count;
+	size_t nRejected{ 0 };
+	if (state->vmNegative)
+	{
+		vmSubmit.clear();
+		vmSubmitIndex.clear();
+		for (size_t i = 0; i < count; i++)
+		{
+			readRequest_t& request = requests[i];
+			if (request.buffer && state->vmNegative->Reject(request.addr, request.szRead, mGeneration))
+			{
+				request.bSuccess = false;
+				memset(request.buffer, 0, request.szRead);
+				nRejected++;
+				continue;
+			}
+
+			vmSubmit.push_back(request);
+			vmSubmitIndex.push_back(i);
+		}
+
+		if (nRejected)
+		{
+			submit = vmSubmit.data();
+			nSubmit = vmSubmit.size();
+		}
+	}
+
+	size_t result{ 0 };
+	if (state->vmReadCache)
+		result = state->vmReadCache->ReadBatch(*backend, submit, nSubmit);
+	else if (state->vmPlanner && nSubmit > 1)
+		result = state->vmPlanner->Execute(*backend, submit, nSubmit);
+	else
+		result = backend->ReadMemoryBatch(submit, nSubmit);
+
+	if (state->vmNegative && result != nSubmit)
+	{
+		for (size_t i = 0; i < nSubmit; i++)
+		{
+			if (submit[i].buffer && !submit[i].bSuccess)
+				RecordFailure(*state, submit[i].addr, submit[i].szRead);
+		}
+	}
+
+	if (state->vmRegions)
+	{
+		for (size_t i = 0; i < nSubmit; i++)
+		{
+			if (submit[i].bSuccess)
+				state->vmRegions->Forget(submit[i].addr, submit[i].szRead);
+		}
+	}
+
+	if (nRejected)
+	{
+		for (size_t i = 0; i < nSubmit; i++)
+			requests[vmSubmitIndex[i]].bSuccess = submit[i].bSuccess;
+	}
+
+	if (state->vmMetrics)
+	{
+		size_t bytes{ 0 };
+		for (size_t i = 0; i < count; i++)
+			bytes += requests[i].szRead;
+
+		timer.Stop(bytes, count - result);
+	}
+
+	return result;
+}
+
+const void* exMemory::ViewMemory(const i64_t& addr, const size_t& szRead, const size_t& align)
+{
+	if (addr % align)
+		return nullptr;
+
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend || !state->vmReadCache)
+		return nullptr;
+
+	//	known bad pages are left to the regular read , which fails them locally
+	if (state->vmNegative && state->vmNegative->IsBad(addr, szRead, mGeneration))
+		return nullptr;
+
+	//	a miss falls back to a regular read , only views that were served are counted
+	exReadTimer timer(state->vmMetrics.get());
+	const void* result = state->vmReadCache->View(*backend, addr, szRead);
+	if (result)
+		timer.Stop(szRead, 0);
+
+	if (result && state->vmProfiler)
+		state->vmProfiler->Record(addr, szRead, mGeneration);
+
+	return result;
+}
+
+void exMemory::SetMirror(const bool& bEnable, const std::chrono::milliseconds& interval)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	const std::shared_ptr<exMemoryMirror> prev = state.vmMirror;
+	state.vmMirror = bEnable ? std::make_shared<exMemoryMirror>(interval) : nullptr;
+	if (state.vmMirror)
+		state.vmMirror->Start(state.vmBackend);
+
+	PublishState(state);
+
+	//	callers may still hold the old mirror , its thread is stopped instead of waiting for the last reference
+	if (prev)
+		prev->Stop();
+}
+
+size_t exMemory::Prefetch()
+{
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend || !state->vmReadCache)
+		return 0;
+
+	exReadTag tag("prefetch");
+	exReadTimer timer(state->vmMetrics.get());
+	const size_t result = state->vmReadCache->Prefetch(*backend);
+	timer.Stop(result * exMemoryBackend::szPage, 0);
+
+	return result;
+}
+
+void exMemory::SetRegionMap(const bool& bEnable)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	state.vmRegions = bEnable ? std::make_shared<exRegionMap>() : nullptr;
+	if (state.vmRegions && state.vmBackend)
+		state.vmRegions->Refresh(*state.vmBackend);
+
+	PublishState(state);
+}
+
+bool exMemory::IsReadable(const i64_t& addr, const size_t& size)
+{
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
 		return false;
 
-	return ReadMemoryEx(vmProcess.hProc, addr, buffer, szRead);
+	if (!state->vmRegions)
+		return true;
+
+	return state->vmRegions->IsReadable(*backend, addr, size);
+}
+
+void exMemory::SetReadCoalescing(const bool& bEnable, const size_t& gap)
+{
+	std::lock_guard<std::mutex> lock(mStateMutex);
+	SState state = *vmState.load();
+	state.vmPlanner = bEnable ? std::make_shared<exReadPlanner>(gap) : nullptr;
+	if (state.vmReadCache)
+		state.vmReadCache->SetCoalesceGap(bEnable ? gap : 0);
+
+	PublishState(state);
+}
+
+size_t exMemory::ReadMemoryPartial(const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask)
+{
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
+	{
+		if (pageMask)
+			pageMask->assign(exMemoryBackend::GetPageCount(addr, szRead), false);
+
+		return 0;
+	}
+
+	if (state->vmProfiler)
+		state->vmProfiler->Record(addr, szRead, mGeneration);
+
+	exReadTimer timer(state->vmMetrics.get());
+	if (!state->vmNegative || !state->vmNegative->IsBad(addr, szRead, mGeneration))
+	{
+		const size_t result = ReadPartialRange(*state, addr, buffer, szRead, pageMask);
+		timer.Stop(szRead, result != szRead);
+		return result;
+	}
+
+	//	known bad pages are zeroed locally , only the runs of pages between them are read
+	const size_t nPages = exMemoryBackend::GetPageCount(addr, szRead);
+	const i64_t end = addr + i64_t(szRead);
+	const i64_t first = addr & ~i64_t(exMemoryBackend::szPage - 1);
+	auto bound = [&](const size_t& page) { return std::clamp<i64_t>(first + i64_t(page * exMemoryBackend::szPage), addr, end); };
+
+	thread_local std::vector<bool> vmBad;
+	vmBad.resize(nPages);
+	for (size_t i = 0; i < nPages; i++)
+		vmBad[i] = state->vmNegative->Reject(bound(i), size_t(bound(i + 1) - bound(i)), mGeneration);
+
+	if (pageMask)
+		pageMask->assign(nPages, false);
+
+	thread_local std::vector<bool> vmRunMask;
+	size_t result{ 0 };
+	for (size_t page = 0; page < nPages;)
+	{
+		size_t last = page + 1;
+		while (last < nPages && vmBad[last] == vmBad[page])
+			last++;
+
+		const i64_t runAddr = bound(page);
+		const size_t szRun = size_t(bound(last) - runAddr);
+		unsigned char* out = static_cast<unsigned char*>(buffer) + (runAddr - addr);
+		if (vmBad[page])
+			memset(out, 0, szRun);
+		else
+		{
+			result += ReadPartialRange(*state, runAddr, out, szRun, &vmRunMask);
+			for (size_t i = 0; pageMask && i < vmRunMask.size(); i++)
+				(*pageMask)[page + i] = vmRunMask[i];
+		}
+
+		page = last;
+	}
+	timer.Stop(szRead, result != szRead);
+
+	return result;
+}
+
+size_t exMemory::ReadPartialRange(const SState& state, const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask)
+{
+	exMemoryBackend& backend = *state.vmBackend;
+
+	//	the page mask tells which pages to record , keep one even if the caller did not ask for it
+	thread_local std::vector<bool> vmMask;
+	std::vector<bool>* mask = pageMask ? pageMask : (state.vmNegative ? &vmMask : nullptr);
+	const size_t result = state.vmReadCache ? state.vmReadCache->ReadPartial(backend, addr, buffer, szRead, mask) : backend.ReadMemoryPartial(addr, buffer, szRead, mask);
+	if (result == szRead && state.vmRegions)
+		state.vmRegions->Forget(addr, szRead);
+
+	if (state.vmNegative && mask && result != szRead)
+	{
+		const i64_t first = addr & ~i64_t(exMemoryBackend::szPage - 1);
+		for (size_t i = 0; i < mask->size(); i++)
+		{
+			if (!(*mask)[i])
+				state.vmNegative->Insert(first + i64_t(i * exMemoryBackend::szPage), 1, mGeneration);
+		}
+	}
+
+	return result;
+}
+
+void exMemory::RecordFailure(const SState& state, const i64_t& addr, const size_t& szRead)
+{
+	if (!state.vmNegative || !szRead)
+		return;
+
+	if (exMemoryBackend::GetPageCount(addr, szRead) == 1)
+	{
+		state.vmNegative->Insert(addr, szRead, mGeneration);
+		return;
+	}
+
+	if (szRead > szMaxProbe)
+		return;
+
+	exMemoryBackend& backend = *state.vmBackend;
+
+	//	one page granular read to tell the unreadable pages from the readable ones , answered from fresh cache pages when the cache is on
+	thread_local std::vector<unsigned char> vmProbe;
+	thread_local std::vector<bool> vmMask;
+	vmProbe.resize(szRead);
+	if (state.vmReadCache)
+		state.vmReadCache->ReadPartial(backend, addr, vmProbe.data(), szRead, &vmMask);
+	else
+		backend.ReadMemoryPartial(addr, vmProbe.data(), szRead, &vmMask);
+
+	const i64_t first = addr & ~i64_t(exMemoryBackend::szPage - 1);
+	for (size_t i = 0; i < vmMask.size(); i++)
+	{
+		if (!vmMask[i])
+			state.vmNegative->Insert(first + i64_t(i * exMemoryBackend::szPage), 1, mGeneration);
+	}
 }
 
 bool exMemory::ReadString(const i64_t& addr, std::string& string, const DWORD& szString)
@@ -440,34 +1478,261 @@ bool exMemory::ReadString(const i64_t& addr, std::string& string, const DWORD& s
 	if (!IsValidInstance())
 		return false;
 
-	return ReadStringEx(vmProcess.hProc, addr, szString, &string);
+	//	read straight into the callers string , its capacity is reused
+	string.resize(szString);
+	if (!ReadMemory(addr, string.data(), szString))
+	{
+		string.clear();
+		return false;
+	}
+
+	string.resize(strnlen(string.data(), szString));
+
+	return true;
+}
+
+std::string_view exMemory::ReadStringView(const i64_t& addr, const size_t& count)
+{
+	const auto chars = ViewArray<char>(addr, count);
+	if (chars.empty())
+		return {};
+
+	return std::string_view(chars.data(), strnlen(chars.data(), chars.size()));
+}
+
+std::string_view exMemory::ReadWideString(const i64_t& addr, const size_t& count)
+{
+	const auto units = ViewArray<char16_t>(addr, count);
+	if (units.empty())
+		return {};
+
+	char* out = static_cast<char*>(vmArena.Allocate(units.size() * 3, 1));
+
+	return std::string_view(out, Utf16ToUtf8(units.data(), units.size(), out));
 }
 
 bool exMemory::WriteMemory(const i64_t& addr, const void* buffer, const DWORD& szWrite)
 {
-	if (!IsValidInstance())
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
 		return false;
 
-	return WriteMemoryEx(vmProcess.hProc, addr, LPVOID(buffer), szWrite);
+	//	invalidated after the write , a reader in between would otherwise cache the old bytes for the rest of the generation
+	const bool result = backend->WriteMemory(addr, buffer, szWrite);
+	if (state->vmReadCache)
+		state->vmReadCache->Invalidate(addr, szWrite);
+
+	if (result && state->vmNegative)
+		state->vmNegative->Forget(addr, szWrite);
+
+	if (result && state->vmRegions)
+		state->vmRegions->Forget(addr, szWrite);
+
+	return result;
+}
+
+size_t exMemory::WriteMemoryBatch(writeRequest_t* requests, const size_t& count)
+{
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
+	{
+		for (size_t i = 0; i < count; i++)
+			requests[i].bSuccess = false;
+
+		return 0;
+	}
+
+	const size_t result = backend->WriteMemoryBatch(requests, count);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (state->vmReadCache)
+			state->vmReadCache->Invalidate(requests[i].addr, requests[i].szWrite);
+
+		if (requests[i].bSuccess && state->vmNegative)
+			state->vmNegative->Forget(requests[i].addr, requests[i].szWrite);
+
+		if (requests[i].bSuccess && state->vmRegions)
+			state->vmRegions->Forget(requests[i].addr, requests[i].szWrite);
+	}
+
+	return result;
+}
+
+size_t exMemory::PatchMemoryBatch(writeRequest_t* requests, const size_t& count)
+{
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+#if defined(_WIN32)
+	const HANDLE hProc = GetBackendHandle(backend);
+	if (hProc == INVALID_HANDLE_VALUE)
+#else
+	const pid_t hProc = GetBackendPID(backend);
+	if (!hProc)
+#endif
+	{
+		for (size_t i = 0; i < count; i++)
+			requests[i].bSuccess = false;
+
+		return 0;
+	}
+
+	const size_t result = PatchMemoryBatchEx(hProc, requests, count);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (state->vmReadCache)
+			state->vmReadCache->Invalidate(requests[i].addr, requests[i].szWrite);
+
+		if (requests[i].bSuccess && state->vmNegative)
+			state->vmNegative->Forget(requests[i].addr, requests[i].szWrite);
+
+		if (requests[i].bSuccess && state->vmRegions)
+			state->vmRegions->Forget(requests[i].addr, requests[i].szWrite);
+	}
+
+	return result;
 }
 
 bool exMemory::PatchMemory(const i64_t& addr, const void* buffer, const DWORD& szWrite)
 {
-	if (!IsValidInstance())
+#if defined(_WIN32)
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	const HANDLE hProc = GetBackendHandle(backend);
+	if (hProc == INVALID_HANDLE_VALUE)
 		return false;
 
-	return PatchMemoryEx(vmProcess.hProc, addr, buffer, szWrite);
+	const bool result = PatchMemoryEx(hProc, addr, buffer, szWrite);
+	if (state->vmReadCache)
+		state->vmReadCache->Invalidate(addr, szWrite);
+
+	if (result && state->vmNegative)
+		state->vmNegative->Forget(addr, szWrite);
+
+	if (result && state->vmRegions)
+		state->vmRegions->Forget(addr, szWrite);
+
+	return result;
+#else
+	writeRequest_t request{ addr, buffer, szWrite };
+	return PatchMemoryBatch(&request, 1) == 1;
+#endif
+}
+
+i64_t exMemory::ReadPointerChain(const i64_t& addr, std::vector<unsigned int>& offsets, i64_t* lpResult)
+{
+	if (!IsValidInstance())
+		return 0;
+
+	i64_t result = addr;
+	for (unsigned int i = 0; i < offsets.size(); ++i)
+	{
+		result = Read<i64_t>(result);
+		result += offsets[i];
+	}
+
+	*lpResult = result;
+
+	return result;
+}
+
+size_t exMemory::CheckSentinels(std::span<exSentinel* const> sentinels)
+{
+	static thread_local std::vector<readRequest_t> requests;
+
+	requests.clear();
+	for (exSentinel* sentinel : sentinels)
+		requests.push_back({ sentinel->mAddr, sentinel->vmCheck.data(), sentinel->mSize });
+
+	ReadMemoryBatch(requests);
+
+	size_t result{ 0 };
+	const unsigned long long generation = mGeneration;
+	for (size_t i = 0; i < sentinels.size(); i++)
+	{
+		exSentinel& sentinel = *sentinels[i];
+		const bool bRead = requests[i].bSuccess && sentinel.mSize;
+		sentinel.bChanged = !bRead || !sentinel.bValid
+			|| sentinel.mGeneration + exSentinel::mMaxAge < generation
+			|| memcmp(sentinel.vmData.data(), sentinel.vmCheck.data(), sentinel.mSize);
+
+		sentinel.bValid = bRead;
+		if (bRead)
+			sentinel.vmData = sentinel.vmCheck;
+
+		if (sentinel.bChanged)
+		{
+			sentinel.mGeneration = generation;
+			result++;
+		}
+	}
+
+	return result;
 }
 
-i64_t exMemory::ReadPointerChain(const i64_t& addr, std::vector<unsigned int>& offsets, i64_t* lpResult)
-{
-	if (!IsValidInstance())
-		return 0;
+i64_t exMemory::ResolvePointerChain(exPointerChain& chain)
+{
+	if (!IsValidInstance())
+		return 0;
+
+	const unsigned long long generation = mGeneration;
+	chain.mStats.mResolves++;
+	if (chain.bValid && chain.mGeneration == generation)
+		return chain.mResult;
+
+	const size_t count = chain.vmOffsets.size();
+	size_t first{ 0 };	//	first link that has to be read again
+
+	//	read every cached link in one batch , the addresses are known from the previous resolve
+	if (chain.bValid)
+	{
+		chain.mStats.mRevalidations++;
+		chain.vmCheck.assign(count, 0);
+		chain.vmRequests.clear();
+		for (size_t i = 0; i < count; i++)
+			chain.vmRequests.push_back({ i ? chain.vmLinks[i - 1] + chain.vmOffsets[i - 1] : chain.mBase, &chain.vmCheck[i], sizeof(i64_t) });
+
+		ReadMemoryBatch(chain.vmRequests);
+		for (; first < count; first++)
+		{
+			if (!chain.vmRequests[first].bSuccess || chain.vmCheck[first] != chain.vmLinks[first])
+				break;
+		}
+
+		if (first == count)
+		{
+			chain.mGeneration = generation;
+			return chain.mResult;
+		}
+
+		//	the read back value of the first changed link is current
+		if (chain.vmRequests[first].bSuccess)
+		{
+			chain.vmLinks[first] = chain.vmCheck[first];
+			first++;
+		}
+	}
+
+	//	walk the remaining links
+	chain.bValid = false;
+	chain.mResult = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (i >= first)
+		{
+			chain.mStats.mWalks++;
+			chain.vmLinks[i] = Read<i64_t>(i ? chain.vmLinks[i - 1] + chain.vmOffsets[i - 1] : chain.mBase);
+		}
 
-	if (!ReadPointerChainEx(vmProcess.hProc, addr, offsets, lpResult))
-		return 0;
+		if (!chain.vmLinks[i])
+			return 0;
+	}
 
-	return *lpResult;
+	chain.bValid = true;
+	chain.mGeneration = generation;
+	chain.mResult = count ? chain.vmLinks[count - 1] + chain.vmOffsets[count - 1] : chain.mBase;
+	return chain.mResult;
 }
 
 i64_t exMemory::GetAddress(const unsigned int& offset, const std::string& modName)
@@ -481,24 +1746,83 @@ bool exMemory::GetAddress(const unsigned int& offset, i64_t* lpResult, const std
 {
 	i64_t result = 0;
 	if (!IsValidInstance())
-		return 0;
+		return false;
 
 	if (modName.empty())
-		result = vmProcess.dwModuleBase + offset;
-	else if (!GetModuleAddressEx(vmProcess.hProc, modName, lpResult))
-		return false;
+		result = AcquireState()->vmProcess.dwModuleBase + offset;
+	else
+	{
+		modInfo_t mod;
+		if (!FindModule(modName, &mod))
+			return false;
+
+		result = mod.dwModuleBase + offset;
+	}
 
 	*lpResult = result;
 
 	return result > 0;
 }
 
-i64_t exMemory::FindPattern(const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction)
+bool exMemory::FindModule(const std::string& modName, modInfo_t* lpResult)
 {
-	if (!IsValidInstance())
+	const std::string& mod_cmp = ToLower(modName);
+	const DWORD dwPID = AcquireState()->vmProcess.dwPID;
+	std::lock_guard<std::mutex> lock(mModMutex);
+	for (int pass = 0; pass < 2; pass++)
+	{
+		auto it = vmModIndex.find(mod_cmp);
+		if (it != vmModIndex.end())
+		{
+			*lpResult = vmModList[it->second];
+			return true;
+		}
+
+		//	not in the table , rebuild once in case it was loaded since , unless it was missing after the last rebuild too
+		if (pass || vmModMisses.count(mod_cmp) || !GetProcessModulesEx(dwPID, vmModList))
+			break;
+
+		vmModIndex.clear();
+		for (size_t i = 0; i < vmModList.size(); i++)
+			vmModIndex.emplace(ToLower(vmModList[i].mModName), i);
+	}
+
+	vmModMisses.insert(mod_cmp);
+
+	return false;
+}
+
+bool exMemory::RefreshModules()
+{
+	const DWORD dwPID = AcquireState()->vmProcess.dwPID;
+	std::lock_guard<std::mutex> lock(mModMutex);
+	vmModIndex.clear();
+	vmModMisses.clear();
+	if (!GetProcessModulesEx(dwPID, vmModList))
+	{
+		vmModList.clear();
+		return false;
+	}
+
+	for (size_t i = 0; i < vmModList.size(); i++)
+		vmModIndex.emplace(ToLower(vmModList[i].mModName), i);
+
+	return true;
+}
+
+i64_t exMemory::FindPattern(const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction, const std::string& modName)
+{
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
+		return 0;
+
+	modInfo_t mod;
+	mod.dwModuleBase = state->vmProcess.dwModuleBase;
+	if (!modName.empty() && !FindModule(modName, &mod))
 		return 0;
 
-	if (!FindPatternEx(vmProcess.hProc, vmProcess.dwModuleBase, signature, lpResult, padding, isRelative, instruction))
+	if (!FindPatternEx(*backend, mod.dwModuleBase, signature, lpResult, padding, isRelative, instruction))
 		return 0;
 
 	return *lpResult;
@@ -506,10 +1830,12 @@ i64_t exMemory::FindPattern(const std::string& signature, i64_t* lpResult, int p
 
 i64_t exMemory::GetSectionHeader(const ESECTIONHEADERS& section, i64_t* lpResult)
 {
-	if (!IsValidInstance())
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
 		return 0;
 
-	if (GetSectionHeaderAddressEx(vmProcess.hProc, vmProcess.dwModuleBase, section, lpResult, nullptr))
+	if (GetSectionHeaderAddressEx(*backend, state->vmProcess.dwModuleBase, section, lpResult, nullptr))
 		return 0;
 
 	return *lpResult;
@@ -517,22 +1843,29 @@ i64_t exMemory::GetSectionHeader(const ESECTIONHEADERS& section, i64_t* lpResult
 
 i64_t exMemory::GetProcAddress(const std::string& fnName, i64_t* lpResult)
 {
-	if (!IsValidInstance())
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	if (!backend)
 		return 0;
 
-	if (!GetProcAddressEx(vmProcess.hProc, vmProcess.dwModuleBase, fnName, lpResult))
+	if (!GetProcAddressEx(*backend, state->vmProcess.dwModuleBase, fnName, lpResult))
 		return 0;
 
 	return *lpResult;
 }
 
+#if defined(_WIN32)
 bool exMemory::LoadLibraryInject(const std::string& dllPath)
 {
-	if (!IsValidInstance())
+	auto state = AcquireState();
+	exMemoryBackend* backend = state->vmBackend.get();
+	const HANDLE hProc = GetBackendHandle(backend);
+	if (hProc == INVALID_HANDLE_VALUE)
 		return false;
 
-	return LoadLibraryInjectorEx(vmProcess.hProc, dllPath);
+	return LoadLibraryInjectorEx(hProc, dllPath);
 }
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
@@ -550,8 +1883,10 @@ bool exMemory::DetachEx(procInfo_t& pInfo)
 {
 	bool result{ true };
 
+#if defined(_WIN32)
 	if (pInfo.bAttached && pInfo.hProc != INVALID_HANDLE_VALUE)
 		CloseHandle(pInfo.hProc);	//	close handle to process
+#endif
 
 	pInfo = procInfo_t();	//	clear process information
 
@@ -615,30 +1950,100 @@ bool exMemory::IsProcessRunning(const std::string& name)
 //
 //-------------------------------------------------------------------------------------------------
 
+#if defined(_WIN32)
 bool exMemory::ReadMemoryEx(const HANDLE& hProc, const i64_t& addr, void* lpResult, size_t szRead)
 {
-	SIZE_T size_read{};
-	return ReadProcessMemory(hProc, LPCVOID(addr), lpResult, szRead, &size_read) && szRead == size_read;
+	return exWin32Backend::ReadMemoryEx(hProc, addr, lpResult, szRead);
+}
+
+size_t exMemory::ReadMemoryBatchEx(const HANDLE& hProc, readRequest_t* requests, const size_t& count)
+{
+	return exWin32Backend(hProc).ReadMemoryBatch(requests, count);
+}
+
+size_t exMemory::ReadMemoryPartialEx(const HANDLE& hProc, const i64_t& addr, void* buffer, const size_t& szRead, std::vector<bool>* pageMask)
+{
+	return exWin32Backend(hProc).ReadMemoryPartial(addr, buffer, szRead, pageMask);
 }
 
 bool exMemory::WriteMemoryEx(const HANDLE& hProc, const i64_t& addr, LPVOID buffer, DWORD szWrite)
 {
-	SIZE_T size_write{};
-	return WriteProcessMemory(hProc, LPVOID(addr), buffer, szWrite, &size_write) && szWrite == size_write;
+	return exWin32Backend::WriteMemoryEx(hProc, addr, buffer, szWrite);
 }
 
 bool exMemory::ReadStringEx(const HANDLE& hProc, const i64_t& addr, const size_t& szString, std::string* lpResult)
 {
-	size_t bytes_read{};
-	char buf[MAX_PATH]{};
-	if (!ReadMemoryEx(hProc, addr, buf, szString))
+	//	read exactly szString bytes , strings longer than MAX_PATH are no longer cut or overflowed
+	lpResult->resize(szString);
+	if (!ReadMemoryEx(hProc, addr, lpResult->data(), szString))
+	{
+		lpResult->clear();
 		return false;
+	}
 
-	*lpResult = std::string(buf);
+	lpResult->resize(strnlen(lpResult->data(), szString));
 
 	return true;
 }
+#endif
+
+size_t exMemory::Utf16ToUtf8(const char16_t* src, const size_t& count, char* out)
+{
+	size_t result{ 0 };
+	size_t i{ 0 };
+	while (i < count)
+	{
+		//	ascii fast path , 4 units per step while none has bits above 0x7F
+		if (i + 4 <= count)
+		{
+			unsigned long long block;
+			memcpy(&block, src + i, sizeof(block));
+			if (!(block & 0xFF80FF80FF80FF80ull))
+			{
+				out[result++] = char(src[i]);
+				out[result++] = char(src[i + 1]);
+				out[result++] = char(src[i + 2]);
+				out[result++] = char(src[i + 3]);
+				i += 4;
+				continue;
+			}
+		}
+
+		unsigned int code = src[i++];
+		if (code >= 0xD800 && code <= 0xDFFF)
+		{
+			if (code <= 0xDBFF && i < count && src[i] >= 0xDC00 && src[i] <= 0xDFFF)
+				code = 0x10000 + ((code - 0xD800) << 10) + (src[i++] - 0xDC00);
+			else
+				code = 0xFFFD;	//	unpaired surrogate
+		}
+
+		if (code < 0x80)
+			out[result++] = char(code);
+		else if (code < 0x800)
+		{
+			out[result++] = char(0xC0 | (code >> 6));
+			out[result++] = char(0x80 | (code & 0x3F));
+		}
+		else if (code < 0x10000)
+		{
+			out[result++] = char(0xE0 | (code >> 12));
+			out[result++] = char(0x80 | ((code >> 6) & 0x3F));
+			out[result++] = char(0x80 | (code & 0x3F));
+		}
+		else
+		{
+			out[result++] = char(0xF0 | (code >> 18));
+			out[result++] = char(0x80 | ((code >> 12) & 0x3F));
+			out[result++] = char(0x80 | ((code >> 6) & 0x3F));
+			out[result++] = char(0x80 | (code & 0x3F));
+		}
+	}
+
+	return result;
+}
 
+#if defined(_WIN32)
 bool exMemory::ReadPointerChainEx(const HANDLE& hProc, const i64_t& addr, const std::vector<unsigned int>& offsets, i64_t* lpResult)
 {
 	i64_t result = addr;
@@ -665,6 +2070,102 @@ bool exMemory::PatchMemoryEx(const HANDLE& hProc, const i64_t& addr, const void*
 	return result;
 }
 
+size_t exMemory::PatchMemoryBatchEx(const HANDLE& hProc, writeRequest_t* requests, const size_t& count)
+{
+	struct SProtect
+	{
+		i64_t						base{ 0 };							//	first page of the range
+		size_t						size{ 0 };							//	bytes , whole pages
+		DWORD						dwProtect{ 0 };						//	protection to restore
+	};
+
+	constexpr i64_t szPage = i64_t(exMemoryBackend::szPage);
+
+	//	page aligned ranges touched by the batch , touching ranges are merged
+	std::vector<std::pair<i64_t, i64_t>> ranges;
+	for (size_t i = 0; i < count; i++)
+	{
+		const writeRequest_t& request = requests[i];
+		if (request.buffer && request.szWrite)
+			ranges.push_back({ request.addr & ~(szPage - 1), (request.addr + i64_t(request.szWrite) + szPage - 1) & ~(szPage - 1) });
+	}
+
+	std::sort(ranges.begin(), ranges.end());
+	size_t nRanges{ 0 };
+	for (const auto& range : ranges)
+	{
+		if (nRanges && range.first <= ranges[nRanges - 1].second)
+			ranges[nRanges - 1].second = std::max(ranges[nRanges - 1].second, range.second);
+		else
+			ranges[nRanges++] = range;
+	}
+	ranges.resize(nRanges);
+
+	//	one query per region of equal protection , only regions that are not writable yet are changed
+	constexpr DWORD dwWritable = PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+	std::vector<SProtect> changed;
+	for (const auto& [first, end] : ranges)
+	{
+		i64_t cursor = first;
+		while (cursor < end)
+		{
+			MEMORY_BASIC_INFORMATION mbi{};
+			if (!VirtualQueryEx(hProc, LPCVOID(cursor), &mbi, sizeof(mbi)) || !mbi.RegionSize)
+				break;	//	the writes themselves report the failure
+
+			const i64_t next = std::min(end, i64_t(mbi.BaseAddress) + i64_t(mbi.RegionSize));
+			if (mbi.State == MEM_COMMIT && (!(mbi.Protect & dwWritable) || (mbi.Protect & PAGE_GUARD)))
+			{
+				DWORD dwOld{ 0 };
+				if (VirtualProtectEx(hProc, LPVOID(cursor), size_t(next - cursor), PAGE_EXECUTE_READWRITE, &dwOld))
+					changed.push_back({ cursor, size_t(next - cursor), dwOld });
+			}
+
+			if (next <= cursor)
+				break;
+
+			cursor = next;
+		}
+	}
+
+	size_t result{ 0 };
+	for (size_t i = 0; i < count; i++)
+	{
+		writeRequest_t& request = requests[i];
+		request.bSuccess = request.buffer && exWin32Backend::WriteMemoryEx(hProc, request.addr, request.buffer, request.szWrite);
+		result += request.bSuccess;
+	}
+
+	//	restore memory protection
+	for (const SProtect& protect : changed)
+	{
+		DWORD dwOld{ 0 };
+		VirtualProtectEx(hProc, LPVOID(protect.base), protect.size, protect.dwProtect, &dwOld);
+	}
+
+	return result;
+}
+#else
+size_t exMemory::PatchMemoryBatchEx(const pid_t& pid, writeRequest_t* requests, const size_t& count)
+{
+	//	the kernel writes through page protection for /proc/<pid>/mem , ptrace access to the process is required
+	const int fd = open(("/proc/" + std::to_string(pid) + "/mem").c_str(), O_RDWR | O_CLOEXEC);
+
+	size_t result{ 0 };
+	for (size_t i = 0; i < count; i++)
+	{
+		writeRequest_t& request = requests[i];
+		request.bSuccess = fd >= 0 && request.buffer && pwrite(fd, request.buffer, request.szWrite, off_t(request.addr)) == ssize_t(request.szWrite);
+		result += request.bSuccess;
+	}
+
+	if (fd >= 0)
+		close(fd);
+
+	return result;
+}
+#endif
+
 
 //-------------------------------------------------------------------------------------------------
 //
@@ -672,7 +2173,8 @@ bool exMemory::PatchMemoryEx(const HANDLE& hProc, const i64_t& addr, const void*
 //
 //-------------------------------------------------------------------------------------------------
 
-bool exMemory::GetActiveProcessesEx(std::vector<procInfo_t>& list)
+#if defined(_WIN32)
+bool exMemory::GetActiveProcessesEx(std::vector<procInfo_t>& list, const std::string& procName)
 {
 	//	snapshot processes
 	HANDLE hSnap = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
@@ -681,13 +2183,14 @@ bool exMemory::GetActiveProcessesEx(std::vector<procInfo_t>& list)
 
 	PROCESSENTRY32 procEntry;
 	procEntry.dwSize = sizeof(procEntry);
-	if (!Process32Next(hSnap, &procEntry))
+	if (!Process32First(hSnap, &procEntry))
 	{
 		CloseHandle(hSnap);
 		return FALSE;
 	}
 
-	//  iterate through all processes
+	//	phase 1 : filter by executable name , the process snapshot already holds it
+	const std::string& proc_cmp = ToLower(procName);
 	std::vector<procInfo_t> active_process_list;
 	do
 	{
@@ -695,47 +2198,51 @@ bool exMemory::GetActiveProcessesEx(std::vector<procInfo_t>& list)
 		if (!procID)
 			continue;
 
-		//	snapshot modules
-		HANDLE modSnap = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPPROCESS, procID);
+		const std::string& exeName = ToString(procEntry.szExeFile);
+		if (!proc_cmp.empty() && ToLower(exeName) != proc_cmp)
+			continue;
+
+		procInfo_t proc;
+		proc.mProcName = exeName;      //  process name
+		proc.dwPID = procID;           //  process ID
+		active_process_list.push_back(proc);
+
+	} while (Process32Next(hSnap, &procEntry));
+
+	CloseHandle(hSnap);
+
+	//	phase 2 : module snapshots only for the matches , the first module entry is the executable
+	std::vector<procInfo_t> result;
+	for (procInfo_t& proc : active_process_list)
+	{
+		HANDLE modSnap = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, proc.dwPID);
 		if (modSnap == INVALID_HANDLE_VALUE)
 			continue;
 
 		MODULEENTRY32 modEntry;
 		modEntry.dwSize = sizeof(modEntry);
-		if (!Module32First(modSnap, &modEntry))
+		if (Module32First(modSnap, &modEntry))
 		{
-			CloseHandle(modSnap);
-			continue;
-		}
-
-		//	 iterate through all modules
-		do
-		{
-			//	compare module names
-			if (_wcsicmp(modEntry.szModule, procEntry.szExeFile))
-				continue;
-
-			//	module found
-			procInfo_t proc;
-			proc.mProcName = ToString(procEntry.szExeFile);      //  process name
-			proc.mProcPath = ToString(modEntry.szExePath);       //  process path
-			proc.dwPID = procID;											   //  process ID
-			proc.dwModuleBase = i64_t(modEntry.modBaseAddr);                   //  module base address
+			do
+			{
+				//	compare module names
+				if (ToLower(ToString(modEntry.szModule)) != ToLower(proc.mProcName))
+					continue;
 
-			//  push back process to list
-			active_process_list.push_back(proc);
+				//	module found
+				proc.mProcPath = ToString(modEntry.szExePath);       //  process path
+				proc.dwModuleBase = i64_t(modEntry.modBaseAddr);     //  module base address
+				result.push_back(proc);
 
-			break;  //  get next process information
+				break;  //  get next process information
 
-		} while (Module32Next(modSnap, &modEntry));
+			} while (Module32Next(modSnap, &modEntry));
+		}
 
 		CloseHandle(modSnap);
+	}
 
-	} while (Process32Next(hSnap, &procEntry));
-
-	CloseHandle(hSnap);
-
-	list = active_process_list;
+	list = result;
 
 	return list.size() > 0;
 }
@@ -743,7 +2250,7 @@ bool exMemory::GetActiveProcessesEx(std::vector<procInfo_t>& list)
 bool exMemory::GetProcessModulesEx(const DWORD& dwPID, std::vector<modInfo_t>& list)
 {
 	//	snapshot modules
-	HANDLE modSnap = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPPROCESS, dwPID);
+	HANDLE modSnap = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, dwPID);
 	if (modSnap == INVALID_HANDLE_VALUE)
 		return false;
 
@@ -763,7 +2270,9 @@ bool exMemory::GetProcessModulesEx(const DWORD& dwPID, std::vector<modInfo_t>& l
 		modInfo_t mod;
 		mod.dwPID = dwPID;												   //  process ID
 		mod.dwModuleBase = i64_t(modEntry.modBaseAddr);					   //  module base address
+		mod.szModule = size_t(modEntry.modBaseSize);					   //  module size
 		mod.mModName = ToString(modEntry.szModule);		   //  module name
+		mod.mModPath = ToString(modEntry.szExePath);	   //  module path
 
 		//  push back module to list
 		active_module_list.push_back(mod);
@@ -776,19 +2285,85 @@ bool exMemory::GetProcessModulesEx(const DWORD& dwPID, std::vector<modInfo_t>& l
 
 	return list.size() > 0;
 }
+#else
+bool exMemory::GetActiveProcessesEx(std::vector<procInfo_t>& list, const std::string& procName)
+{
+	//	/proc is filtered by name before any process is resolved , see exLinuxBackend::FindProcessesEx
+	std::vector<linuxProcInfo_t> procs;
+	exLinuxBackend::FindProcessesEx(procName, procs);
+
+	list.clear();
+	for (const linuxProcInfo_t& entry : procs)
+	{
+		procInfo_t proc;
+		proc.dwPID = DWORD(entry.dwPID);
+		proc.dwModuleBase = entry.dwModuleBase;
+		proc.mProcName = entry.mProcName;
+		proc.mProcPath = entry.mProcPath;
+		list.push_back(proc);
+	}
+
+	return list.size() > 0;
+}
+
+bool exMemory::GetProcessModulesEx(const DWORD& dwPID, std::vector<modInfo_t>& list)
+{
+	FILE* maps = fopen(("/proc/" + std::to_string(dwPID) + "/maps").c_str(), "r");
+	if (!maps)
+		return false;
+
+	//	mappings of a file are listed in address order , a module spans from its first to its last mapping
+	std::vector<modInfo_t> active_module_list;
+	std::unordered_map<std::string, size_t> index;
+	char line[512];
+	while (fgets(line, sizeof(line), maps))
+	{
+		char* path = strchr(line, '/');
+		if (!path)
+			continue;
+
+		path[strcspn(path, "\n")] = 0;
+		char* end{ nullptr };
+		const i64_t first = i64_t(strtoull(line, &end, 16));
+		const i64_t last = i64_t(strtoull(end + 1, nullptr, 16));
+
+		auto [it, bInserted] = index.try_emplace(path, active_module_list.size());
+		if (bInserted)
+		{
+			const std::string modPath = path;
+			const size_t pos = modPath.find_last_of("/\\");
+
+			modInfo_t mod;
+			mod.dwPID = dwPID;
+			mod.dwModuleBase = first;
+			mod.mModName = pos == std::string::npos ? modPath : modPath.substr(pos + 1);
+			mod.mModPath = modPath;
+			active_module_list.push_back(mod);
+		}
+
+		modInfo_t& mod = active_module_list[it->second];
+		mod.szModule = size_t(std::max(last, mod.dwModuleBase + i64_t(mod.szModule)) - mod.dwModuleBase);
+	}
+	fclose(maps);
+
+	list = active_module_list;
+
+	return list.size() > 0;
+}
+#endif
 
 bool exMemory::FindProcessEx(const std::string& procName, procInfo_t* procInfo, const bool& bAttach, const DWORD& dwDesiredAccess)
 {
 	std::vector<procInfo_t> list;
-	if (!GetActiveProcessesEx(list))
+	if (!GetActiveProcessesEx(list, procName))
 		return false;
 
 	auto it = std::find_if(
 		list.begin(),
 		list.end(),
-		[procName](procInfo_t& p)
+		[&procName](procInfo_t& p)
 		{
-			return p.mProcName == procName;
+			return ToLower(p.mProcName) == ToLower(procName);
 		}
 	);
 
@@ -802,6 +2377,7 @@ bool exMemory::FindProcessEx(const std::string& procName, procInfo_t* procInfo,
 	{
 		proc.dwAccessLevel = dwDesiredAccess;
 
+#if defined(_WIN32)
 		//  attempt to get main process window
 		EnumWindowData eDat;
 		eDat.procId = proc.dwPID;
@@ -817,6 +2393,11 @@ bool exMemory::FindProcessEx(const std::string& procName, procInfo_t* procInfo,
 		proc.hProc = OpenProcess(proc.dwAccessLevel, false, it->dwPID);
 
 		proc.bAttached = proc.hProc != INVALID_HANDLE_VALUE;
+#else
+		//	there is no handle to open , access is checked by reading the executable's first page
+		unsigned char probe{ 0 };
+		proc.bAttached = !proc.dwModuleBase || exLinuxBackend(pid_t(proc.dwPID)).ReadMemory(proc.dwModuleBase, &probe, sizeof(probe));
+#endif
 	}
 
 	if (procInfo)
@@ -827,75 +2408,23 @@ bool exMemory::FindProcessEx(const std::string& procName, procInfo_t* procInfo,
 
 bool exMemory::FindModuleEx(const std::string& procName, const std::string& modName, modInfo_t* lpResult)
 {
-	const auto& proc_cmp = ToLower(procName);
-	const auto& mod_cmp = ToLower(modName);
-	bool bFound{ false };
-	modInfo_t modInfo;
-
-	//	snapshot processes
-	HANDLE hSnap = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
-	if (hSnap == INVALID_HANDLE_VALUE)
-		return FALSE;
-
-	PROCESSENTRY32 procEntry;
-	procEntry.dwSize = sizeof(procEntry);
-	if (!Process32Next(hSnap, &procEntry))
-	{
-		CloseHandle(hSnap);
-		return FALSE;
-	}
-
-	//  iterate through all processes
-	do
-	{
-		//	compare process names
-		if (ToLower(ToString(procEntry.szExeFile)) != proc_cmp)
-			continue;
-
-		//	snapshot modules
-		HANDLE modSnap = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPPROCESS, procEntry.th32ProcessID);
-		if (modSnap == INVALID_HANDLE_VALUE)
-			break;
-
-		MODULEENTRY32 modEntry;
-		modEntry.dwSize = sizeof(modEntry);
-		if (!Module32First(modSnap, &modEntry))
-		{
-			CloseHandle(modSnap);
-			break;
-		}
-
-		//	 iterate through all modules
-		do
-		{
-			//	compare module names
-			if (ToLower(ToString(modEntry.szModule)) != mod_cmp)
-				continue;
-
-			//	module found
-			bFound = true;
-
-			//	get module properties
-			modInfo.dwModuleBase = i64_t(modEntry.modBaseAddr);                   //  module base address
-			modInfo.dwPID = procEntry.th32ProcessID;                              //  process ID
-			modInfo.mModName = ToString(modEntry.szModule);		//  module name
-
-			//	pass ref
-			*lpResult = modInfo;
-
-			break;
-
-		} while (Module32Next(modSnap, &modEntry));
-
-		CloseHandle(modSnap);
+	//	only processes with a matching name are snapshotted
+	std::vector<procInfo_t> procs;
+	if (!GetActiveProcessesEx(procs, procName))
+		return false;
 
-		break;
+	const auto& mod_cmp = ToLower(modName);
+	std::vector<modInfo_t> mods;
+	if (!GetProcessModulesEx(procs.front().dwPID, mods))
+		return false;
 
-	} while (Process32Next(hSnap, &procEntry));
+	auto it = std::find_if(mods.begin(), mods.end(), [&mod_cmp](const modInfo_t& mod) { return ToLower(mod.mModName) == mod_cmp; });
+	if (it == mods.end())
+		return false;
 
-	CloseHandle(hSnap);
+	*lpResult = *it;
 
-	return bFound;
+	return true;
 }
 
 
@@ -905,21 +2434,32 @@ bool exMemory::FindModuleEx(const std::string& procName, const std::string& modN
 //
 //-------------------------------------------------------------------------------------------------
 
+#if defined(_WIN32)
 bool exMemory::GetModuleAddressEx(const HANDLE& hProc, const std::string& moduleName, i64_t* lpResult)
 {
-	DWORD cbNeeded;
-	HMODULE modules[1024];
-	if (!EnumProcessModulesEx(hProc, modules, sizeof(modules), &cbNeeded, LIST_MODULES_ALL))
-		return false;
+	//	grow the list until every module fits
+	DWORD cbNeeded{ 0 };
+	std::vector<HMODULE> modules(1024);
+	do
+	{
+		if (!EnumProcessModulesEx(hProc, modules.data(), DWORD(modules.size() * sizeof(HMODULE)), &cbNeeded, LIST_MODULES_ALL))
+			return false;
 
+		if (cbNeeded <= modules.size() * sizeof(HMODULE))
+			break;
+
+		modules.resize(cbNeeded / sizeof(HMODULE));
+	} while (true);
+
+	const auto& mod_cmp = ToLower(moduleName);
 	const auto szModule = cbNeeded / sizeof(HMODULE);
-	for (int i = 0; i < szModule; i++)
+	for (size_t i = 0; i < szModule; i++)
 	{
 		wchar_t modName[MAX_PATH];
 		if (!GetModuleBaseName(hProc, modules[i], modName, sizeof(modName) / sizeof(wchar_t)))
 			continue;
 
-		if (ToLower(ToString(modName)) != moduleName)
+		if (ToLower(ToString(modName)) != mod_cmp)
 			continue;
 
 		*lpResult = reinterpret_cast<i64_t>(modules[i]);
@@ -940,6 +2480,13 @@ bool exMemory::GetSectionHeaderAddressEx(const HANDLE& hProc, const std::string&
 }
 
 bool exMemory::GetSectionHeaderAddressEx(const HANDLE& hProc, const i64_t& dwModule, const ESECTIONHEADERS& section, i64_t* lpResult, size_t* szImage)
+{
+	exWin32Backend backend(hProc);
+	return GetSectionHeaderAddressEx(backend, dwModule, section, lpResult, szImage);
+}
+#endif
+
+bool exMemory::GetSectionHeaderAddressEx(exMemoryBackend& backend, const i64_t& dwModule, const ESECTIONHEADERS& section, i64_t* lpResult, size_t* szImage)
 {
 	//	get segment title
 	std::string segment;
@@ -956,13 +2503,13 @@ bool exMemory::GetSectionHeaderAddressEx(const HANDLE& hProc, const i64_t& dwMod
 		return false;
 
 	//	get dos header
-	const auto& image_dos_header = ReadEx<IMAGE_DOS_HEADER>(hProc, dwModule);
+	const auto& image_dos_header = backend.Read<IMAGE_DOS_HEADER>(dwModule);
 	if (image_dos_header.e_magic != IMAGE_DOS_SIGNATURE)
 		return false;
 
 	//	get nt headers
 	const auto& e_lfanew = dwModule + image_dos_header.e_lfanew;
-	const auto& image_nt_headers = ReadEx<IMAGE_NT_HEADERS>(hProc, e_lfanew);
+	const auto& image_nt_headers = backend.Read<IMAGE_NT_HEADERS>(e_lfanew);
 	if (image_nt_headers.Signature != IMAGE_NT_SIGNATURE)
 		return false;
 
@@ -970,12 +2517,12 @@ bool exMemory::GetSectionHeaderAddressEx(const HANDLE& hProc, const i64_t& dwMod
 	size_t section_size = 0;
 	i64_t section_base = 0;
 	const auto& image_section_header = e_lfanew + sizeof(IMAGE_NT_HEADERS);
-	IMAGE_SECTION_HEADER section_headers_base = ReadEx<IMAGE_SECTION_HEADER>(hProc, image_section_header);
+	IMAGE_SECTION_HEADER section_headers_base = backend.Read<IMAGE_SECTION_HEADER>(image_section_header);
 	for (int i = 0; i < image_nt_headers.FileHeader.NumberOfSections; ++i)
 	{
 		if (strncmp(reinterpret_cast<const char*>(section_headers_base.Name), segment.c_str(), segment.size()) != 0)
 		{
-			section_headers_base = ReadEx<IMAGE_SECTION_HEADER>(hProc, image_section_header + (sizeof(IMAGE_SECTION_HEADER) * i));
+			section_headers_base = backend.Read<IMAGE_SECTION_HEADER>(image_section_header + (sizeof(IMAGE_SECTION_HEADER) * i));
 			continue;
 		}
 
@@ -993,6 +2540,7 @@ bool exMemory::GetSectionHeaderAddressEx(const HANDLE& hProc, const i64_t& dwMod
 	return true;
 }
 
+#if defined(_WIN32)
 bool exMemory::FindPatternEx(const HANDLE& hProc, const std::string& moduleName, const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction)
 {
 	i64_t dwModuleBase = 0;
@@ -1004,61 +2552,35 @@ bool exMemory::FindPatternEx(const HANDLE& hProc, const std::string& moduleName,
 
 bool exMemory::FindPatternEx(const HANDLE& hProc, const i64_t& dwModule, const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction)
 {
-	static auto pattern_to_byte = [](const char* pattern)
-		{
-			const auto start = const_cast<char*>(pattern);
-			const auto end = const_cast<char*>(pattern) + strlen(pattern);
-
-			auto bytes = std::vector<int>{};
-			for (auto current = start; current < end; ++current)
-			{
-				if (*current == '?')
-				{
-					++current;
-					bytes.push_back(-1);
-				}
-				else
-				{
-					bytes.push_back(strtoul(current, &current, 16));
-				}
-			}
-			return bytes;
-		};
+	exWin32Backend backend(hProc);
+	return FindPatternEx(backend, dwModule, signature, lpResult, padding, isRelative, instruction);
+}
+#endif
 
+bool exMemory::FindPatternEx(exMemoryBackend& backend, const i64_t& dwModule, const std::string& signature, i64_t* lpResult, int padding, bool isRelative, EASM instruction)
+{
 	i64_t result = 0;
 
+	//	get pattern
+	const exSignature pattern(signature);
+	if (!pattern.IsValid())
+		return false;
+
 	//	Get .text segment
 	i64_t section_base = 0;
 	size_t section_size = 0;
-	if (!GetSectionHeaderAddressEx(hProc, dwModule, ESECTIONHEADERS::SECTION_TEXT, &section_base, &section_size))
+	if (!GetSectionHeaderAddressEx(backend, dwModule, ESECTIONHEADERS::SECTION_TEXT, &section_base, &section_size))
 		return false;
 
-	//	get pattern
-	const auto pattern_bytes = pattern_to_byte(signature.c_str());
-	const auto cbSize = pattern_bytes.size();
-	const auto cbData = pattern_bytes.data();
-
 	//	read section
-	std::vector<unsigned __int8> scan_bytes(section_size);
-	if (!ReadMemoryEx(hProc, section_base, scan_bytes.data(), scan_bytes.size()))
+	std::vector<unsigned char> scan_bytes(section_size);
+	if (!backend.ReadMemory(section_base, scan_bytes.data(), scan_bytes.size()))
 		return false;
 
-	//	iterate through buffer & compare with pattern
-	for (auto i = 0ul; i < section_size - cbSize; ++i)
+	//	vectorized search , see exSignature::Find
+	const size_t i = pattern.Find(scan_bytes.data(), scan_bytes.size());
+	if (i != exSignature::npos)
 	{
-		bool found = true;
-		for (auto j = 0ul; j < cbSize; ++j)
-		{
-			if (scan_bytes[i + j] != cbData[j] && cbData[j] != -1)
-			{
-				found = false;
-				break;
-			}
-		}
-
-		if (!found)
-			continue;
-
 		//	set result address
 		auto address = section_base + i;
 
@@ -1070,21 +2592,19 @@ bool exMemory::FindPatternEx(const HANDLE& hProc, const i64_t& dwModule, const s
 		switch (instruction)
 		{
 		case EASM::ASM_NULL: { result = address; break; }
-		case EASM::ASM_MOV: { const auto offset = ReadEx<int>(hProc, address + 3); return isRelative ? *lpResult = address + offset + 7 : result = address; }
-		case EASM::ASM_CALL: { const auto offset = ReadEx<int>(hProc, address + 1); return isRelative ? *lpResult = address + offset + 5 : result = address; }
-		case EASM::ASM_LEA: { const auto offset = ReadEx<int>(hProc, address + 3); return isRelative ? *lpResult = address + offset + 7 : result = address; }
-		case EASM::ASM_CMP: { const auto offset = ReadEx<int>(hProc, address + 2); return isRelative ? *lpResult = address + offset + 6 : result = address; }
+		case EASM::ASM_MOV: { const auto offset = backend.Read<int>(address + 3); return isRelative ? *lpResult = address + offset + 7 : result = address; }
+		case EASM::ASM_CALL: { const auto offset = backend.Read<int>(address + 1); return isRelative ? *lpResult = address + offset + 5 : result = address; }
+		case EASM::ASM_LEA: { const auto offset = backend.Read<int>(address + 3); return isRelative ? *lpResult = address + offset + 7 : result = address; }
+		case EASM::ASM_CMP: { const auto offset = backend.Read<int>(address + 2); return isRelative ? *lpResult = address + offset + 6 : result = address; }
 		}
-
-		break;
 	}
 
-
 	*lpResult = result;
 
 	return result > 0;
 }
 
+#if defined(_WIN32)
 bool exMemory::GetProcAddressEx(const HANDLE& hProc, const std::string& moduleName, const std::string& fnName, i64_t* lpResult)
 {
 	i64_t dwModuleBase = 0;
@@ -1095,23 +2615,30 @@ bool exMemory::GetProcAddressEx(const HANDLE& hProc, const std::string& moduleNa
 }
 
 bool exMemory::GetProcAddressEx(const HANDLE& hProc, const i64_t& dwModule, const std::string& fnName, i64_t* lpResult)
+{
+	exWin32Backend backend(hProc);
+	return GetProcAddressEx(backend, dwModule, fnName, lpResult);
+}
+#endif
+
+bool exMemory::GetProcAddressEx(exMemoryBackend& backend, const i64_t& dwModule, const std::string& fnName, i64_t* lpResult)
 {
 	const auto& fnNameLower = ToLower(fnName);
 
 	//	get image doe header
-	const auto& image_dos_header = ReadEx<IMAGE_DOS_HEADER>(hProc, dwModule);
+	const auto& image_dos_header = backend.Read<IMAGE_DOS_HEADER>(dwModule);
 	if (image_dos_header.e_magic != IMAGE_DOS_SIGNATURE)
 		return false;
 
 	//	get nt headers
-	const auto& image_nt_headers = ReadEx<IMAGE_NT_HEADERS>(hProc, dwModule + image_dos_header.e_lfanew);
+	const auto& image_nt_headers = backend.Read<IMAGE_NT_HEADERS>(dwModule + image_dos_header.e_lfanew);
 	if (image_nt_headers.Signature != IMAGE_NT_SIGNATURE
 		|| image_nt_headers.OptionalHeader.NumberOfRvaAndSizes <= 0)
 		return false;
 
 	//	get export directory
 	const auto& export_directory_va = image_nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT].VirtualAddress + dwModule;
-	const auto& export_directory = ReadEx<IMAGE_EXPORT_DIRECTORY>(hProc, export_directory_va);
+	const auto& export_directory = backend.Read<IMAGE_EXPORT_DIRECTORY>(export_directory_va);
 	if (!export_directory.AddressOfNames || !export_directory.AddressOfFunctions || !export_directory.AddressOfNameOrdinals)
 		return false;
 
@@ -1122,21 +2649,23 @@ bool exMemory::GetProcAddressEx(const HANDLE& hProc, const i64_t& dwModule, cons
 	for (int i = 0; i < export_directory.NumberOfNames; i++)
 	{
 		//	get address of name
-		const auto& name_rva = ReadEx<DWORD>(hProc, names_va + (i * 0x4));
+		const auto& name_rva = backend.Read<DWORD>(names_va + (i * 0x4));
 		const auto& name_va = name_rva + dwModule;
 
 		//	read & compare name with input string
-		std::string cmp;
-		if (!ReadStringEx(hProc, name_va, MAX_PATH, &cmp))
+		char name[MAX_PATH]{};
+		if (!backend.ReadMemory(name_va, name, sizeof(name) - 1))
 			continue;
 
+		const std::string cmp(name);
+
 		//	compare strings
 		if (fnNameLower != ToLower(cmp))
 			continue;
 
 		//	get function address
-		const auto& name_ordinal = ReadEx<short>(hProc, ordinals_va + (i * 0x2));				//	get ordinal at the current index
-		const auto& function_rva = ReadEx<DWORD>(hProc, functions_va + (name_ordinal * 0x4));	//	get function va from the ordinal index of the functions array
+		const auto& name_ordinal = backend.Read<short>(ordinals_va + (i * 0x2));				//	get ordinal at the current index
+		const auto& function_rva = backend.Read<DWORD>(functions_va + (name_ordinal * 0x4));	//	get function va from the ordinal index of the functions array
 
 		//	pass result
 		*lpResult = i64_t(function_rva + dwModule);
@@ -1154,6 +2683,7 @@ bool exMemory::GetProcAddressEx(const HANDLE& hProc, const i64_t& dwModule, cons
 //
 //-------------------------------------------------------------------------------------------------
 
+#if defined(_WIN32)
 bool exMemory::LoadLibraryInjectorEx(const HANDLE& hProc, const std::string& dllPath)
 {
 	//  allocate memory
@@ -1203,6 +2733,7 @@ BOOL CALLBACK exMemory::GetProcWindowEx(HWND window, LPARAM lParam)
 
 	return true;
 }
+#endif
 
 
 //-------------------------------------------------------------------------------------------------
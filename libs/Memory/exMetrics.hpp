@@ -0,0 +1,200 @@
+//	exMemory read metrics | syscalls , bytes , failures & latency percentiles per call site
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "exBackend.hpp"
+#include "exProfiler.hpp"
+
+//	counters of one call site
+typedef struct READMETRIC64
+{
+	std::string						name;								//	tag name , see exReadTag
+	size_t							mCalls{ 0 };						//	exMemory read calls
+	size_t							mSyscalls{ 0 };						//	read syscalls issued by those calls , cache hits issue none
+	size_t							mBytes{ 0 };						//	bytes requested
+	size_t							mFailures{ 0 };						//	requests that were not read completely
+	double							mTotalUs{ 0 };						//	time spent in the calls
+	double							mP50Us{ 0 };						//	median call latency
+	double							mP99Us{ 0 };						//	99th percentile call latency
+	double							mMaxUs{ 0 };						//	slowest call
+} READMETRIC32, readMetric_t;
+
+/*
+*	always on counters for exMemory reads keyed by the current exReadTag
+*	latencies go into a log scale histogram ( 4 buckets per power of two ) so percentiles cost no per call storage
+*/
+class exReadMetrics
+{
+public:
+	static constexpr size_t			mBuckets = 256;						//	histogram buckets , covers every 64 bit nanosecond value
+
+public:
+
+	/* adds one read call under the current exReadTag */
+	inline void Record(const size_t& syscalls, const size_t& bytes, const size_t& failures, const unsigned long long& ns);
+
+	/* returns the counters of every call site , descending by time spent */
+	inline std::vector<readMetric_t> GetMetrics();
+
+	/* drops every counter , e.g. to measure a window of ticks */
+	inline void Clear();
+
+private:
+	struct STag
+	{
+		size_t						mCalls{ 0 };
+		size_t						mSyscalls{ 0 };
+		size_t						mBytes{ 0 };
+		size_t						mFailures{ 0 };
+		unsigned long long			mTotalNs{ 0 };
+		unsigned long long			mMaxNs{ 0 };
+		std::array<unsigned int, mBuckets>	vmHistogram{};				//	call count per latency bucket
+	};
+
+	/* returns the histogram bucket of a latency */
+	static inline size_t GetBucket(const unsigned long long& ns)
+	{
+		if (ns < 4)
+			return size_t(ns);
+
+		const size_t exp = size_t(std::bit_width(ns)) - 1;
+		return exp * 4 + size_t((ns >> (exp - 2)) & 3);
+	}
+
+	/* returns the middle of a histogram bucket in nanoseconds */
+	static inline double GetBucketValue(const size_t& bucket)
+	{
+		if (bucket < 4)
+			return double(bucket);
+
+		const size_t exp = bucket / 4;
+		const double low = double((4 + bucket % 4)) * double(1ull << (exp - 2));
+		return low + double(1ull << (exp - 2)) * 0.5;
+	}
+
+	/* returns the latency below which a fraction of the calls completed , in nanoseconds */
+	static inline double GetPercentile(const STag& tag, const double& fraction);
+
+private:
+	std::mutex						mMutex;
+	std::unordered_map<const char*, STag>	vmTags;						//	keyed by the tag literal
+};
+
+/*
+*	measures one exMemory read call , started on construction & recorded by Stop
+*	syscalls are counted from exMemoryBackend::SyscallCount of the calling thread
+*/
+class exReadTimer
+{
+public:
+	explicit inline exReadTimer(exReadMetrics* metrics) : pMetrics(metrics)
+	{
+		if (!pMetrics)
+			return;
+
+		mSyscalls = exMemoryBackend::SyscallCount();
+		mStart = std::chrono::steady_clock::now();
+	}
+
+	/* records the call , failures is the number of requests that were not read completely */
+	inline void Stop(const size_t& bytes, const size_t& failures)
+	{
+		if (!pMetrics)
+			return;
+
+		const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart).count();
+		pMetrics->Record(size_t(exMemoryBackend::SyscallCount() - mSyscalls), bytes, failures, (unsigned long long)std::max<long long>(ns, 0));
+	}
+
+private:
+	exReadMetrics*					pMetrics{ nullptr };				//	nullptr while metrics are disabled
+	unsigned long long				mSyscalls{ 0 };						//	thread syscall count at the start
+	std::chrono::steady_clock::time_point	mStart;						//	start of the call
+};
+
+void exReadMetrics::Record(const size_t& syscalls, const size_t& bytes, const size_t& failures, const unsigned long long& ns)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	STag& tag = vmTags[exReadTag::Current()];
+	tag.mCalls++;
+	tag.mSyscalls += syscalls;
+	tag.mBytes += bytes;
+	tag.mFailures += failures;
+	tag.mTotalNs += ns;
+	tag.mMaxNs = std::max(tag.mMaxNs, ns);
+	tag.vmHistogram[GetBucket(ns)]++;
+}
+
+std::vector<readMetric_t> exReadMetrics::GetMetrics()
+{
+	//	the same name used in several translation units may be several literals , merge by name
+	std::unordered_map<std::string, STag> merged;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (const auto& [name, tag] : vmTags)
+		{
+			STag& result = merged[name];
+			result.mCalls += tag.mCalls;
+			result.mSyscalls += tag.mSyscalls;
+			result.mBytes += tag.mBytes;
+			result.mFailures += tag.mFailures;
+			result.mTotalNs += tag.mTotalNs;
+			result.mMaxNs = std::max(result.mMaxNs, tag.mMaxNs);
+			for (size_t i = 0; i < mBuckets; i++)
+				result.vmHistogram[i] += tag.vmHistogram[i];
+		}
+	}
+
+	std::vector<readMetric_t> result;
+	result.reserve(merged.size());
+	for (const auto& [name, tag] : merged)
+	{
+		readMetric_t metric;
+		metric.name = name;
+		metric.mCalls = tag.mCalls;
+		metric.mSyscalls = tag.mSyscalls;
+		metric.mBytes = tag.mBytes;
+		metric.mFailures = tag.mFailures;
+		metric.mTotalUs = double(tag.mTotalNs) / 1000.0;
+		metric.mP50Us = GetPercentile(tag, 0.50) / 1000.0;
+		metric.mP99Us = GetPercentile(tag, 0.99) / 1000.0;
+		metric.mMaxUs = double(tag.mMaxNs) / 1000.0;
+		result.push_back(std::move(metric));
+	}
+
+	std::sort(result.begin(), result.end(), [](const readMetric_t& a, const readMetric_t& b) { return a.mTotalUs > b.mTotalUs; });
+
+	return result;
+}
+
+void exReadMetrics::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	vmTags.clear();
+}
+
+double exReadMetrics::GetPercentile(const STag& tag, const double& fraction)
+{
+	if (!tag.mCalls)
+		return 0;
+
+	//	first bucket holding the ranked call , capped at the slowest call seen
+	const size_t rank = std::max<size_t>(1, size_t(double(tag.mCalls) * fraction + 0.5));
+	size_t count{ 0 };
+	for (size_t i = 0; i < mBuckets; i++)
+	{
+		count += tag.vmHistogram[i];
+		if (count >= rank)
+			return std::min(GetBucketValue(i), double(tag.mMaxNs));
+	}
+
+	return double(tag.mMaxNs);
+}
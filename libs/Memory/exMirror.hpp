@@ -0,0 +1,351 @@
+//	exMemory mirror | background thread keeping local copies of hot remote ranges fresh
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "exBackend.hpp"
+
+//	byte range of a mirrored range that changed , relative to the start of the range
+typedef struct MIRRORINTERVAL64
+{
+	size_t							offset{ 0 };						//	first changed byte
+	size_t							size{ 0 };							//	changed bytes
+} MIRRORINTERVAL32, mirrorInterval_t;
+
+//	mirror counters
+typedef struct MIRRORSTATS64
+{
+	size_t							mSyncs{ 0 };						//	passes over every range
+	size_t							mBytesRead{ 0 };					//	bytes read from the target
+	size_t							mFailures{ 0 };						//	range reads that failed
+	size_t							mLocalReads{ 0 };					//	reads served from a local copy
+	double							mLastSyncMs{ 0 };					//	duration of the last pass
+} MIRRORSTATS32, mirrorStats_t;
+
+/*
+*	registered ranges are read in one batch every interval by a background thread & kept as local copies
+*	bytes that differ from the previous copy are recorded as dirty intervals until the owner collects them with GetDirty
+*	Read serves any range covered by a synced copy , so a reader does no syscall for mirrored memory
+*/
+class exMemoryMirror
+{
+public:
+	static constexpr size_t			szMaxRange = 0x100000;				//	largest mirrored range
+	static constexpr size_t			szDirtyGrain = 0x40;				//	granularity of dirty intervals
+	static constexpr size_t			mMaxDirty = 0x100;					//	intervals kept per range before they collapse into one
+
+public:
+	explicit inline exMemoryMirror(const std::chrono::milliseconds& interval = std::chrono::milliseconds(4)) : mInterval(interval) {}
+	inline ~exMemoryMirror() noexcept { Stop(); }
+
+	exMemoryMirror(const exMemoryMirror&) = delete;
+	exMemoryMirror& operator=(const exMemoryMirror&) = delete;
+
+public:
+
+	/* starts ( or restarts ) the sync thread on a backend , the mirror keeps its own reference to the backend */
+	inline void Start(const std::shared_ptr<exMemoryBackend>& backend);
+
+	/* stops the sync thread , local copies are kept but no longer synced */
+	inline void Stop();
+
+	/* returns true while the sync thread runs */
+	inline bool IsRunning() const { return bRunning; }
+
+	/* registers a remote range & returns its id , the range is readable locally after the next sync */
+	inline size_t Register(const i64_t& addr, const size_t& size);
+
+	/* moves or resizes a registered range , the local copy is dropped until the next sync if the range changed */
+	inline void SetRange(const size_t& id, const i64_t& addr, const size_t& size);
+
+	/* stops mirroring a range */
+	inline void Unregister(const size_t& id);
+
+	/* copies bytes from a synced local copy
+	* returns false if no synced range covers the whole request
+	*/
+	inline bool Read(const i64_t& addr, void* buffer, const size_t& size);
+
+	/* returns true if the range holds a synced copy of its current address */
+	inline bool IsSynced(const size_t& id);
+
+	/* moves the dirty intervals recorded since the last call into out , merged & sorted
+	* returns true if anything changed , a range that was ( re )synced for the first time is dirty as a whole
+	*/
+	inline bool GetDirty(const size_t& id, std::vector<mirrorInterval_t>& out);
+
+	/* sets the time between two syncs */
+	inline void SetInterval(const std::chrono::milliseconds& interval) { mInterval = interval; }
+
+	/* returns a copy of the mirror counters */
+	inline mirrorStats_t GetStats();
+
+private:
+	struct SRange
+	{
+		size_t						id{ 0 };							//	handle returned by Register
+		i64_t						addr{ 0 };							//	remote address
+		size_t						size{ 0 };							//	bytes mirrored
+		std::vector<unsigned char>	data;								//	local copy
+		std::vector<mirrorInterval_t>	dirty;							//	changes not collected yet
+		bool						bSynced{ false };					//	data holds a successful read
+	};
+
+	/* sync thread body */
+	inline void Run(std::shared_ptr<exMemoryBackend> backend);
+
+	/* reads every range once & updates the local copies */
+	inline void Sync(exMemoryBackend& backend);
+
+	/* records a changed interval , neighbours within a grain are merged */
+	static inline void MarkDirty(SRange& range, const size_t& offset, const size_t& size);
+
+private:
+	std::mutex						mMutex;								//	guards ranges & counters
+	std::vector<SRange>				vmRanges;							//	registered ranges
+	size_t							mNextId{ 1 };						//	id of the next registration
+	mirrorStats_t					mStats;								//	counters
+
+	std::thread						mThread;							//	sync thread
+	std::mutex						mWaitMutex;							//	guards the stop signal
+	std::condition_variable			mWake;								//	wakes the sync thread on stop
+	std::atomic<bool>				bRunning{ false };					//	sync thread is running
+	std::atomic<std::chrono::milliseconds>	mInterval;					//	time between syncs
+
+	//	sync thread buffers , reused
+	std::vector<SRange>				vmWork;								//	ranges being read
+	std::vector<readRequest_t>		vmRequests;							//	one request per range
+};
+
+void exMemoryMirror::Start(const std::shared_ptr<exMemoryBackend>& backend)
+{
+	Stop();
+	if (!backend)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (SRange& range : vmRanges)
+			range.bSynced = false;	//	copies belong to the previous backend
+	}
+
+	bRunning = true;
+	mThread = std::thread(&exMemoryMirror::Run, this, backend);
+}
+
+void exMemoryMirror::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(mWaitMutex);
+		bRunning = false;
+	}
+	mWake.notify_all();
+
+	if (mThread.joinable())
+		mThread.join();
+}
+
+size_t exMemoryMirror::Register(const i64_t& addr, const size_t& size)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	SRange range;
+	range.id = mNextId++;
+	range.addr = addr;
+	range.size = std::min(size, szMaxRange);
+	vmRanges.push_back(std::move(range));
+
+	return vmRanges.back().id;
+}
+
+void exMemoryMirror::SetRange(const size_t& id, const i64_t& addr, const size_t& size)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	auto it = std::find_if(vmRanges.begin(), vmRanges.end(), [&id](const SRange& range) { return range.id == id; });
+	const size_t szRange = std::min(size, szMaxRange);
+	if (it == vmRanges.end() || (it->addr == addr && it->size == szRange))
+		return;
+
+	it->addr = addr;
+	it->size = szRange;
+	it->bSynced = false;
+	it->dirty.clear();
+}
+
+void exMemoryMirror::Unregister(const size_t& id)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	std::erase_if(vmRanges, [&id](const SRange& range) { return range.id == id; });
+}
+
+bool exMemoryMirror::Read(const i64_t& addr, void* buffer, const size_t& size)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	for (const SRange& range : vmRanges)
+	{
+		if (!range.bSynced || addr < range.addr || addr + i64_t(size) > range.addr + i64_t(range.size))
+			continue;
+
+		memcpy(buffer, range.data.data() + (addr - range.addr), size);
+		mStats.mLocalReads++;
+		return true;
+	}
+
+	return false;
+}
+
+bool exMemoryMirror::IsSynced(const size_t& id)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	auto it = std::find_if(vmRanges.begin(), vmRanges.end(), [&id](const SRange& range) { return range.id == id; });
+	return it != vmRanges.end() && it->bSynced;
+}
+
+bool exMemoryMirror::GetDirty(const size_t& id, std::vector<mirrorInterval_t>& out)
+{
+	out.clear();
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	auto it = std::find_if(vmRanges.begin(), vmRanges.end(), [&id](const SRange& range) { return range.id == id; });
+	if (it == vmRanges.end())
+		return false;
+
+	out.swap(it->dirty);
+
+	//	intervals of several syncs , sort & merge
+	std::sort(out.begin(), out.end(), [](const mirrorInterval_t& a, const mirrorInterval_t& b) { return a.offset < b.offset; });
+	size_t count{ 0 };
+	for (const mirrorInterval_t& interval : out)
+	{
+		if (count && interval.offset <= out[count - 1].offset + out[count - 1].size)
+		{
+			mirrorInterval_t& last = out[count - 1];
+			last.size = std::max(last.offset + last.size, interval.offset + interval.size) - last.offset;
+			continue;
+		}
+
+		out[count++] = interval;
+	}
+	out.resize(count);
+
+	return !out.empty();
+}
+
+mirrorStats_t exMemoryMirror::GetStats()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mStats;
+}
+
+void exMemoryMirror::Run(std::shared_ptr<exMemoryBackend> backend)
+{
+	while (bRunning)
+	{
+		Sync(*backend);
+
+		std::unique_lock<std::mutex> lock(mWaitMutex);
+		mWake.wait_for(lock, mInterval.load(), [this]() { return !bRunning; });
+	}
+}
+
+void exMemoryMirror::Sync(exMemoryBackend& backend)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	//	take the range list , reads happen without holding the lock
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		vmWork.resize(vmRanges.size());
+		for (size_t i = 0; i < vmRanges.size(); i++)
+		{
+			vmWork[i].id = vmRanges[i].id;
+			vmWork[i].addr = vmRanges[i].addr;
+			vmWork[i].size = vmRanges[i].size;
+			vmWork[i].data.resize(vmRanges[i].size);
+		}
+	}
+
+	vmRequests.clear();
+	for (SRange& work : vmWork)
+		vmRequests.push_back({ work.addr, work.data.data(), work.size });
+
+	backend.ReadMemoryBatch(vmRequests.data(), vmRequests.size());
+
+	//	compare with the local copies of ranges that were not moved meanwhile
+	std::lock_guard<std::mutex> lock(mMutex);
+	mStats.mSyncs++;
+	for (size_t i = 0; i < vmWork.size(); i++)
+	{
+		SRange& work = vmWork[i];
+		auto it = std::find_if(vmRanges.begin(), vmRanges.end(), [&work](const SRange& range) { return range.id == work.id; });
+		if (it == vmRanges.end() || it->addr != work.addr || it->size != work.size)
+			continue;
+
+		SRange& range = *it;
+		if (!vmRequests[i].bSuccess)
+		{
+			mStats.mFailures++;
+			continue;
+		}
+
+		mStats.mBytesRead += work.size;
+		if (!range.bSynced)
+		{
+			range.dirty.clear();
+			MarkDirty(range, 0, range.size);
+		}
+		else
+		{
+			for (size_t offset = 0; offset < range.size; offset += szDirtyGrain)
+			{
+				const size_t size = std::min(szDirtyGrain, range.size - offset);
+				if (memcmp(range.data.data() + offset, work.data.data() + offset, size))
+					MarkDirty(range, offset, size);
+			}
+		}
+
+		range.data.swap(work.data);
+		range.bSynced = true;
+	}
+
+	mStats.mLastSyncMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void exMemoryMirror::MarkDirty(SRange& range, const size_t& offset, const size_t& size)
+{
+	//	intervals are appended in address order within a sync , only the last one can touch a new one
+	if (!range.dirty.empty())
+	{
+		mirrorInterval_t& last = range.dirty.back();
+		if (offset >= last.offset && offset <= last.offset + last.size + szDirtyGrain)
+		{
+			last.size = std::max(last.offset + last.size, offset + size) - last.offset;
+			return;
+		}
+	}
+
+	//	an owner that does not collect , keep one interval covering everything
+	if (range.dirty.size() >= mMaxDirty)
+	{
+		size_t first = offset;
+		size_t end = offset + size;
+		for (const mirrorInterval_t& interval : range.dirty)
+		{
+			first = std::min(first, interval.offset);
+			end = std::max(end, interval.offset + interval.size);
+		}
+
+		range.dirty.assign(1, { first, end - first });
+		return;
+	}
+
+	range.dirty.push_back({ offset, size });
+}
@@ -0,0 +1,171 @@
+//	exMemory negative cache | pages that recently failed to read , so repeated reads of freed memory fail locally
+
+#pragma once
+#include <mutex>
+#include <unordered_map>
+#include "exBackend.hpp"
+
+//	negative cache counters
+typedef struct NEGATIVECACHESTATS64
+{
+	size_t							mAvoided{ 0 };						//	reads failed locally instead of with a syscall
+	size_t							mRecorded{ 0 };						//	pages recorded as unreadable
+	size_t							mExpired{ 0 };						//	pages dropped after their expiry
+	size_t							mPages{ 0 };						//	pages currently recorded
+} NEGATIVECACHESTATS32, negativeCacheStats_t;
+
+/*
+*	remote pages keyed by base address & the generation their read failed in
+*	a read touching a recorded page fails without reaching the target until mExpiry generations have passed , then the page is tried again
+*	a successful write to a page proves it is mapped & forgets it
+*/
+class exNegativeCache
+{
+public:
+	static constexpr size_t			szPage = exMemoryBackend::szPage;	//	cache granularity
+	static constexpr size_t			mMaxPages = 0x1000;					//	pages kept before expired pages are pruned
+
+public:
+	explicit inline exNegativeCache(const unsigned long long& expiry = 16) : mExpiry(expiry) {}
+
+public:
+
+	/* returns true if a page of the range failed within the expiry , does not count as avoided */
+	inline bool IsBad(const i64_t& addr, const size_t& size, const unsigned long long& generation);
+
+	/* same as IsBad , a rejected read is counted as avoided */
+	inline bool Reject(const i64_t& addr, const size_t& size, const unsigned long long& generation);
+
+	/* records every page of the range as unreadable in the generation */
+	inline void Insert(const i64_t& addr, const size_t& size, const unsigned long long& generation);
+
+	/* forgets every page of the range */
+	inline void Forget(const i64_t& addr, const size_t& size);
+
+	/* drops expired pages once the cache holds more than mMaxPages */
+	inline void NextGeneration(const unsigned long long& generation);
+
+	/* sets the number of generations a failed page is rejected for */
+	inline void SetExpiry(const unsigned long long& expiry);
+
+	/* drops all pages */
+	inline void Clear();
+
+	/* returns a copy of the negative cache counters */
+	inline negativeCacheStats_t GetStats();
+
+private:
+	std::mutex										mMutex;
+	std::unordered_map<i64_t, unsigned long long>	vmPages;			//	page base -> generation of the failed read
+	unsigned long long								mExpiry;			//	generations a page is rejected for
+	negativeCacheStats_t							mStats;				//	counters
+};
+
+bool exNegativeCache::IsBad(const i64_t& addr, const size_t& size, const unsigned long long& generation)
+{
+	if (!size)
+		return false;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (vmPages.empty())
+		return false;
+
+	const i64_t first = addr & ~i64_t(szPage - 1);
+	const i64_t last = (addr + size - 1) & ~i64_t(szPage - 1);
+	for (i64_t base = first; base <= last; base += szPage)
+	{
+		auto it = vmPages.find(base);
+		if (it == vmPages.end())
+			continue;
+
+		if (generation - it->second < mExpiry)
+			return true;
+
+		vmPages.erase(it);
+		mStats.mExpired++;
+	}
+
+	return false;
+}
+
+bool exNegativeCache::Reject(const i64_t& addr, const size_t& size, const unsigned long long& generation)
+{
+	if (!IsBad(addr, size, generation))
+		return false;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	mStats.mAvoided++;
+
+	return true;
+}
+
+void exNegativeCache::Insert(const i64_t& addr, const size_t& size, const unsigned long long& generation)
+{
+	if (!size)
+		return;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	const i64_t first = addr & ~i64_t(szPage - 1);
+	const i64_t last = (addr + size - 1) & ~i64_t(szPage - 1);
+	for (i64_t base = first; base <= last; base += szPage)
+	{
+		auto [it, bInserted] = vmPages.try_emplace(base, generation);
+		it->second = generation;
+		mStats.mRecorded += bInserted;
+	}
+}
+
+void exNegativeCache::Forget(const i64_t& addr, const size_t& size)
+{
+	if (!size)
+		return;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (vmPages.empty())
+		return;
+
+	const i64_t first = addr & ~i64_t(szPage - 1);
+	const i64_t last = (addr + size - 1) & ~i64_t(szPage - 1);
+	for (i64_t base = first; base <= last; base += szPage)
+		vmPages.erase(base);
+}
+
+void exNegativeCache::NextGeneration(const unsigned long long& generation)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (vmPages.size() <= mMaxPages)
+		return;
+
+	for (auto it = vmPages.begin(); it != vmPages.end();)
+	{
+		if (generation - it->second >= mExpiry)
+		{
+			it = vmPages.erase(it);
+			mStats.mExpired++;
+		}
+		else
+			++it;
+	}
+}
+
+void exNegativeCache::SetExpiry(const unsigned long long& expiry)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mExpiry = expiry;
+}
+
+void exNegativeCache::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	vmPages.clear();
+}
+
+negativeCacheStats_t exNegativeCache::GetStats()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	negativeCacheStats_t result = mStats;
+	result.mPages = vmPages.size();
+
+	return result;
+}
@@ -0,0 +1,176 @@
+//	exMemory read planner | merges nearby read requests into fewer , larger reads
+
+#pragma once
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#include "exBackend.hpp"
+
+//	read planner counters
+typedef struct READPLANSTATS64
+{
+	size_t							mRequests{ 0 };						//	requests planned
+	size_t							mSpans{ 0 };						//	reads issued after merging
+	size_t							mBytesRequested{ 0 };				//	bytes asked for by callers
+	size_t							mBytesRead{ 0 };					//	bytes read including gaps
+	size_t							mRetries{ 0 };						//	requests re-read alone after their span failed
+} READPLANSTATS32, readPlanStats_t;
+
+/*
+*	sorts a batch by address and merges requests that overlap or sit within mGap bytes of each other
+*	each merged span is read once , results are scattered back to the original destinations
+*	a span that fails ( e.g. the gap crosses an unmapped page ) has its requests retried individually
+*/
+class exReadPlanner
+{
+public:
+	explicit inline exReadPlanner(const size_t& gap = 0x100, const size_t& maxSpan = 0x10000) : mGap(gap), mMaxSpan(maxSpan) {}
+
+public:
+
+	/* reads a list of requests through merged spans
+	* returns the number of requests that were read completely
+	*/
+	inline size_t Execute(exMemoryBackend& backend, readRequest_t* requests, const size_t& count);
+
+	/* sets the largest gap in bytes between two requests that are still merged */
+	inline void SetGap(const size_t& gap) { mGap = gap; }
+	inline const size_t& GetGap() const { return mGap; }
+
+	/* sets the largest span in bytes a merge may produce */
+	inline void SetMaxSpan(const size_t& maxSpan) { mMaxSpan = maxSpan; }
+	inline const size_t& GetMaxSpan() const { return mMaxSpan; }
+
+	/* returns the planner counters */
+	inline const readPlanStats_t& GetStats() const { return mStats; }
+	inline void ResetStats() { mStats = readPlanStats_t(); }
+
+private:
+
+	/* builds merged spans for the batch */
+	inline void Plan(const readRequest_t* requests, const size_t& count);
+
+private:
+	static constexpr size_t			npos = size_t(-1);
+
+	size_t							mGap{ 0 };							//	merge threshold in bytes
+	size_t							mMaxSpan{ 0 };						//	largest merged read
+	readPlanStats_t					mStats;								//	counters
+	std::mutex						mMutex;								//	guards the reused buffers
+
+	std::vector<size_t>				vmOrder;							//	request indices sorted by address , reused
+	std::vector<size_t>				vmSpanOf;							//	span index of each request , reused
+	std::vector<readRequest_t>		vmSpans;							//	merged reads , reused
+	std::vector<readRequest_t>		vmRetry;							//	requests of failed spans , reused
+	std::vector<size_t>				vmRetryIndex;						//	index of each retry in the callers list , reused
+	std::vector<unsigned char>		vmScratch;							//	span buffer , reused
+};
+
+void exReadPlanner::Plan(const readRequest_t* requests, const size_t& count)
+{
+	vmOrder.clear();
+	vmSpans.clear();
+	vmSpanOf.assign(count, npos);
+	for (size_t i = 0; i < count; i++)
+	{
+		if (requests[i].buffer && requests[i].szRead)
+			vmOrder.push_back(i);
+	}
+
+	std::sort(vmOrder.begin(), vmOrder.end(), [requests](const size_t& a, const size_t& b) { return requests[a].addr < requests[b].addr; });
+
+	//	merge , span buffers are assigned once the total size is known
+	for (const size_t& index : vmOrder)
+	{
+		const readRequest_t& request = requests[index];
+		const i64_t end = request.addr + request.szRead;
+		if (!vmSpans.empty())
+		{
+			readRequest_t& span = vmSpans.back();
+			const i64_t spanEnd = span.addr + span.szRead;
+			const i64_t mergedEnd = std::max(spanEnd, end);
+			if (request.addr <= spanEnd + mGap && mergedEnd - span.addr <= mMaxSpan)
+			{
+				span.szRead = size_t(mergedEnd - span.addr);
+				vmSpanOf[index] = vmSpans.size() - 1;
+				continue;
+			}
+		}
+
+		vmSpans.push_back({ request.addr, nullptr, request.szRead });
+		vmSpanOf[index] = vmSpans.size() - 1;
+	}
+
+	size_t total{ 0 };
+	for (const readRequest_t& span : vmSpans)
+		total += span.szRead;
+
+	vmScratch.resize(total);
+	total = 0;
+	for (readRequest_t& span : vmSpans)
+	{
+		span.buffer = vmScratch.data() + total;
+		total += span.szRead;
+	}
+}
+
+size_t exReadPlanner::Execute(exMemoryBackend& backend, readRequest_t* requests, const size_t& count)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	Plan(requests, count);
+	backend.ReadMemoryBatch(vmSpans.data(), vmSpans.size());
+
+	//	scatter results
+	size_t result{ 0 };
+	vmRetry.clear();
+	vmRetryIndex.clear();
+	for (size_t i = 0; i < count; i++)
+	{
+		readRequest_t& request = requests[i];
+		const size_t& spanIndex = vmSpanOf[i];
+		if (spanIndex == npos)
+		{
+			request.bSuccess = request.buffer != nullptr;
+			result += request.bSuccess;
+			continue;
+		}
+
+		mStats.mRequests++;
+		mStats.mBytesRequested += request.szRead;
+
+		const readRequest_t& span = vmSpans[spanIndex];
+		if (!span.bSuccess && span.addr == request.addr && span.szRead == request.szRead)
+		{
+			memset(request.buffer, 0, request.szRead);	//	the span was exactly this request , a retry would fail the same way
+			request.bSuccess = false;
+			continue;
+		}
+
+		if (!span.bSuccess)
+		{
+			vmRetry.push_back(request);
+			vmRetryIndex.push_back(i);
+			continue;
+		}
+
+		memcpy(request.buffer, static_cast<const unsigned char*>(span.buffer) + (request.addr - span.addr), request.szRead);
+		request.bSuccess = true;
+		result++;
+	}
+
+	for (const readRequest_t& span : vmSpans)
+		mStats.mBytesRead += span.szRead;
+
+	mStats.mSpans += vmSpans.size();
+
+	//	the requested bytes may be readable even if the gap between them is not
+	if (!vmRetry.empty())
+	{
+		mStats.mRetries += vmRetry.size();
+		result += backend.ReadMemoryBatch(vmRetry.data(), vmRetry.size());
+		for (size_t i = 0; i < vmRetry.size(); i++)
+			requests[vmRetryIndex[i]].bSuccess = vmRetry[i].bSuccess;
+	}
+
+	return result;
+}
@@ -0,0 +1,160 @@
+//	exMemory platform types | win32 names & pe image layouts for builds without windows.h
+
+#pragma once
+#if !defined(_WIN32)
+#include <cstdint>
+
+//	win32 integer & handle types , sized as on windows
+typedef uint32_t						DWORD;
+typedef int32_t							LONG;
+typedef uint16_t						WORD;
+typedef uint8_t							BYTE;
+typedef uint64_t						ULONGLONG;
+typedef int								BOOL;
+typedef void*							HANDLE;
+typedef void*							HWND;
+typedef void*							HMODULE;
+typedef void*							LPVOID;
+typedef const void*						LPCVOID;
+typedef intptr_t						LPARAM;
+
+//	msvc sized integer keywords used by sdk headers
+#if !defined(_MSC_VER)
+#define __int8							char
+#define __int16							short
+#define __int32							int
+#define __int64							long long
+#endif
+
+#define CALLBACK
+#define INVALID_HANDLE_VALUE			((HANDLE)(intptr_t)-1)
+#define PROCESS_ALL_ACCESS				0x1FFFFF
+#ifndef MAX_PATH
+#define MAX_PATH						260
+#endif
+
+//	pe image layouts , the target is a windows executable even when the tool is not
+//	ref: https://learn.microsoft.com/en-us/windows/win32/api/winnt/ns-winnt-image_nt_headers64
+#define IMAGE_DOS_SIGNATURE				0x5A4D							//	MZ
+#define IMAGE_NT_SIGNATURE				0x00004550						//	PE00
+#define IMAGE_NUMBEROF_DIRECTORY_ENTRIES	16
+#define IMAGE_DIRECTORY_ENTRY_EXPORT	0
+#define IMAGE_SIZEOF_SHORT_NAME			8
+
+typedef struct _IMAGE_DOS_HEADER
+{
+	WORD							e_magic;
+	WORD							e_cblp;
+	WORD							e_cp;
+	WORD							e_crlc;
+	WORD							e_cparhdr;
+	WORD							e_minalloc;
+	WORD							e_maxalloc;
+	WORD							e_ss;
+	WORD							e_sp;
+	WORD							e_csum;
+	WORD							e_ip;
+	WORD							e_cs;
+	WORD							e_lfarlc;
+	WORD							e_ovno;
+	WORD							e_res[4];
+	WORD							e_oemid;
+	WORD							e_oeminfo;
+	WORD							e_res2[10];
+	LONG							e_lfanew;						//	offset of the nt headers
+} IMAGE_DOS_HEADER;
+
+typedef struct _IMAGE_FILE_HEADER
+{
+	WORD							Machine;
+	WORD							NumberOfSections;
+	DWORD							TimeDateStamp;
+	DWORD							PointerToSymbolTable;
+	DWORD							NumberOfSymbols;
+	WORD							SizeOfOptionalHeader;
+	WORD							Characteristics;
+} IMAGE_FILE_HEADER;
+
+typedef struct _IMAGE_DATA_DIRECTORY
+{
+	DWORD							VirtualAddress;
+	DWORD							Size;
+} IMAGE_DATA_DIRECTORY;
+
+typedef struct _IMAGE_OPTIONAL_HEADER64
+{
+	WORD							Magic;
+	BYTE							MajorLinkerVersion;
+	BYTE							MinorLinkerVersion;
+	DWORD							SizeOfCode;
+	DWORD							SizeOfInitializedData;
+	DWORD							SizeOfUninitializedData;
+	DWORD							AddressOfEntryPoint;
+	DWORD							BaseOfCode;
+	ULONGLONG						ImageBase;
+	DWORD							SectionAlignment;
+	DWORD							FileAlignment;
+	WORD							MajorOperatingSystemVersion;
+	WORD							MinorOperatingSystemVersion;
+	WORD							MajorImageVersion;
+	WORD							MinorImageVersion;
+	WORD							MajorSubsystemVersion;
+	WORD							MinorSubsystemVersion;
+	DWORD							Win32VersionValue;
+	DWORD							SizeOfImage;
+	DWORD							SizeOfHeaders;
+	DWORD							CheckSum;
+	WORD							Subsystem;
+	WORD							DllCharacteristics;
+	ULONGLONG						SizeOfStackReserve;
+	ULONGLONG						SizeOfStackCommit;
+	ULONGLONG						SizeOfHeapReserve;
+	ULONGLONG						SizeOfHeapCommit;
+	DWORD							LoaderFlags;
+	DWORD							NumberOfRvaAndSizes;
+	IMAGE_DATA_DIRECTORY			DataDirectory[IMAGE_NUMBEROF_DIRECTORY_ENTRIES];
+} IMAGE_OPTIONAL_HEADER64;
+
+typedef struct _IMAGE_NT_HEADERS64
+{
+	DWORD							Signature;
+	IMAGE_FILE_HEADER				FileHeader;
+	IMAGE_OPTIONAL_HEADER64			OptionalHeader;
+} IMAGE_NT_HEADERS64, IMAGE_NT_HEADERS;
+
+typedef struct _IMAGE_SECTION_HEADER
+{
+	BYTE							Name[IMAGE_SIZEOF_SHORT_NAME];
+	union
+	{
+		DWORD						PhysicalAddress;
+		DWORD						VirtualSize;
+	} Misc;
+	DWORD							VirtualAddress;
+	DWORD							SizeOfRawData;
+	DWORD							PointerToRawData;
+	DWORD							PointerToRelocations;
+	DWORD							PointerToLinenumbers;
+	WORD							NumberOfRelocations;
+	WORD							NumberOfLinenumbers;
+	DWORD							Characteristics;
+} IMAGE_SECTION_HEADER;
+
+typedef struct _IMAGE_EXPORT_DIRECTORY
+{
+	DWORD							Characteristics;
+	DWORD							TimeDateStamp;
+	WORD							MajorVersion;
+	WORD							MinorVersion;
+	DWORD							Name;
+	DWORD							Base;
+	DWORD							NumberOfFunctions;
+	DWORD							NumberOfNames;
+	DWORD							AddressOfFunctions;				//	rva of the function rva array
+	DWORD							AddressOfNames;					//	rva of the name rva array
+	DWORD							AddressOfNameOrdinals;			//	rva of the ordinal array
+} IMAGE_EXPORT_DIRECTORY;
+
+static_assert(sizeof(IMAGE_DOS_HEADER) == 64 && sizeof(IMAGE_NT_HEADERS64) == 264 && sizeof(IMAGE_SECTION_HEADER) == 40 && sizeof(IMAGE_EXPORT_DIRECTORY) == 40, "pe layouts must match winnt.h");
+
+#endif
@@ -0,0 +1,259 @@
+//	exMemory read profiler | logs remote reads by call site & reports hot pages , redundant bytes & possible coalescing
+
+#pragma once
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "exBackend.hpp"
+
+/*
+*	names the call site of the reads issued while it is in scope , scopes nest & are per thread
+*	e.g. exReadTag tag("bones");
+*/
+class exReadTag
+{
+public:
+	explicit inline exReadTag(const char* tag) : mPrevious(Current()) { Current() = tag; }
+	inline ~exReadTag() noexcept { Current() = mPrevious; }
+
+	exReadTag(const exReadTag&) = delete;
+	exReadTag& operator=(const exReadTag&) = delete;
+
+	/* returns the tag of the innermost scope on this thread */
+	static inline const char*& Current() { static thread_local const char* tag = "untagged"; return tag; }
+
+private:
+	const char*						mPrevious;							//	tag restored when the scope ends
+};
+
+//	one logged read
+typedef struct READTRACEENTRY64
+{
+	const char*						tag{ nullptr };						//	call site , see exReadTag
+	i64_t							addr{ 0 };							//	remote address
+	size_t							size{ 0 };							//	bytes requested
+	unsigned long long				mTick{ 0 };							//	read generation
+} READTRACEENTRY32, readTraceEntry_t;
+
+//	read count & bytes of a page or tag
+typedef struct READPROFILEBUCKET64
+{
+	i64_t							key{ 0 };							//	page base , unused for tags
+	std::string						name;								//	tag name , empty for pages
+	size_t							mReads{ 0 };						//	reads touching the bucket
+	size_t							mBytes{ 0 };						//	bytes requested
+	size_t							mRedundant{ 0 };					//	bytes already read earlier in the same tick
+} READPROFILEBUCKET32, readProfileBucket_t;
+
+//	summary of the logged reads
+typedef struct READPROFILEREPORT64
+{
+	size_t							mReads{ 0 };						//	reads logged
+	size_t							mTicks{ 0 };						//	ticks covered
+	size_t							mBytes{ 0 };						//	bytes requested
+	size_t							mRedundant{ 0 };					//	bytes requested more than once within a tick
+	size_t							mCoalescable{ 0 };					//	reads that could merge with their neighbour under the report gap
+	size_t							mGapBytes{ 0 };						//	extra bytes those merges would read
+	std::vector<readProfileBucket_t>	vmHotPages;						//	most read pages , descending
+	std::vector<readProfileBucket_t>	vmTags;							//	per call site totals , descending by bytes
+} READPROFILEREPORT32, readProfileReport_t;
+
+/*
+*	records every read ( call site , address , size , tick ) up to mMaxEntries & builds a report from the log
+*	redundant bytes & coalescing are measured per tick , reads from different ticks never overlap
+*/
+class exReadProfiler
+{
+public:
+	static constexpr size_t			mMaxEntries = 0x100000;				//	entries logged before recording stops
+	static constexpr size_t			mHotPages = 32;						//	pages listed in a report
+
+public:
+
+	/* logs a read under the current exReadTag */
+	inline void Record(const i64_t& addr, const size_t& size, const unsigned long long& tick);
+
+	/* builds a report , reads closer than gap bytes count as coalescable */
+	inline readProfileReport_t GetReport(const size_t& gap = 0x100);
+
+	/* writes every logged read as csv : tick,tag,address,size */
+	inline bool ExportCSV(const std::string& path);
+
+	/* writes the report as json */
+	inline bool ExportJSON(const std::string& path, const size_t& gap = 0x100);
+
+	/* drops the log */
+	inline void Clear();
+
+	/* returns the number of logged reads */
+	inline size_t GetCount();
+
+private:
+	std::mutex						mMutex;
+	std::vector<readTraceEntry_t>	vmEntries;							//	log in recording order
+};
+
+void exReadProfiler::Record(const i64_t& addr, const size_t& size, const unsigned long long& tick)
+{
+	if (!size)
+		return;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (vmEntries.size() >= mMaxEntries)
+		return;
+
+	vmEntries.push_back({ exReadTag::Current(), addr, size, tick });
+}
+
+readProfileReport_t exReadProfiler::GetReport(const size_t& gap)
+{
+	std::vector<readTraceEntry_t> entries;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		entries = vmEntries;
+	}
+
+	readProfileReport_t result;
+	result.mReads = entries.size();
+
+	std::unordered_map<i64_t, readProfileBucket_t> pages;
+	std::unordered_map<std::string, readProfileBucket_t> tags;
+	for (const readTraceEntry_t& entry : entries)
+	{
+		result.mBytes += entry.size;
+
+		readProfileBucket_t& tag = tags[entry.tag];
+		tag.name = entry.tag;
+		tag.mReads++;
+		tag.mBytes += entry.size;
+
+		const i64_t first = entry.addr & ~i64_t(exMemoryBackend::szPage - 1);
+		const i64_t last = (entry.addr + entry.size - 1) & ~i64_t(exMemoryBackend::szPage - 1);
+		for (i64_t base = first; base <= last; base += exMemoryBackend::szPage)
+		{
+			readProfileBucket_t& page = pages[base];
+			page.key = base;
+			page.mReads++;
+			page.mBytes += size_t(std::min(entry.addr + i64_t(entry.size), base + i64_t(exMemoryBackend::szPage)) - std::max(entry.addr, base));
+		}
+	}
+
+	//	per tick sweep in address order , overlap with the furthest end seen so far was already read
+	std::stable_sort(entries.begin(), entries.end(), [](const readTraceEntry_t& a, const readTraceEntry_t& b) { return a.mTick != b.mTick ? a.mTick < b.mTick : a.addr < b.addr; });
+	i64_t reach{ 0 };
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		const readTraceEntry_t& entry = entries[i];
+		const i64_t end = entry.addr + i64_t(entry.size);
+		if (!i || entries[i - 1].mTick != entry.mTick)
+		{
+			result.mTicks++;
+			reach = end;
+			continue;
+		}
+
+		if (entry.addr < reach)
+		{
+			const size_t redundant = size_t(std::min(end, reach) - entry.addr);
+			result.mRedundant += redundant;
+			tags[entry.tag].mRedundant += redundant;
+		}
+		else if (size_t(entry.addr - reach) <= gap)
+		{
+			result.mCoalescable++;
+			result.mGapBytes += size_t(entry.addr - reach);
+		}
+
+		reach = std::max(reach, end);
+	}
+
+	for (auto& [base, page] : pages)
+		result.vmHotPages.push_back(page);
+
+	std::sort(result.vmHotPages.begin(), result.vmHotPages.end(), [](const readProfileBucket_t& a, const readProfileBucket_t& b) { return a.mReads > b.mReads; });
+	if (result.vmHotPages.size() > mHotPages)
+		result.vmHotPages.resize(mHotPages);
+
+	for (auto& [name, tag] : tags)
+		result.vmTags.push_back(tag);
+
+	std::sort(result.vmTags.begin(), result.vmTags.end(), [](const readProfileBucket_t& a, const readProfileBucket_t& b) { return a.mBytes > b.mBytes; });
+
+	return result;
+}
+
+bool exReadProfiler::ExportCSV(const std::string& path)
+{
+	std::ofstream file(path);
+	if (!file.is_open())
+		return false;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	file << "tick,tag,address,size\n";
+	for (const readTraceEntry_t& entry : vmEntries)
+		file << entry.mTick << ',' << entry.tag << ",0x" << std::hex << entry.addr << std::dec << ',' << entry.size << '\n';
+
+	return file.good();
+}
+
+bool exReadProfiler::ExportJSON(const std::string& path, const size_t& gap)
+{
+	const readProfileReport_t report = GetReport(gap);
+
+	std::ofstream file(path);
+	if (!file.is_open())
+		return false;
+
+	file << "{\n";
+	file << "\t\"reads\": " << report.mReads << ",\n";
+	file << "\t\"ticks\": " << report.mTicks << ",\n";
+	file << "\t\"bytes\": " << report.mBytes << ",\n";
+	file << "\t\"redundant_bytes\": " << report.mRedundant << ",\n";
+	file << "\t\"coalesce_gap\": " << gap << ",\n";
+	file << "\t\"coalescable_reads\": " << report.mCoalescable << ",\n";
+	file << "\t\"coalesce_gap_bytes\": " << report.mGapBytes << ",\n";
+
+	file << "\t\"hot_pages\": [";
+	for (size_t i = 0; i < report.vmHotPages.size(); i++)
+	{
+		const readProfileBucket_t& page = report.vmHotPages[i];
+		file << (i ? ",\n" : "\n") << "\t\t{ \"page\": \"0x" << std::hex << page.key << std::dec << "\", \"reads\": " << page.mReads << ", \"bytes\": " << page.mBytes << " }";
+	}
+	file << "\n\t],\n";
+
+	//	tags are call site literals , quotes & backslashes are the only characters escaped
+	file << "\t\"tags\": [";
+	for (size_t i = 0; i < report.vmTags.size(); i++)
+	{
+		const readProfileBucket_t& tag = report.vmTags[i];
+		std::string name;
+		for (const char& c : tag.name)
+		{
+			if (c == '"' || c == '\\')
+				name.push_back('\\');
+
+			name.push_back(c);
+		}
+
+		file << (i ? ",\n" : "\n") << "\t\t{ \"tag\": \"" << name << "\", \"reads\": " << tag.mReads << ", \"bytes\": " << tag.mBytes << ", \"redundant_bytes\": " << tag.mRedundant << " }";
+	}
+	file << "\n\t]\n";
+	file << "}\n";
+
+	return file.good();
+}
+
+void exReadProfiler::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	vmEntries.clear();
+}
+
+size_t exReadProfiler::GetCount()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return vmEntries.size();
+}
@@ -0,0 +1,227 @@
+//	exMemory region map | local copy of the target's address space layout for pointer plausibility checks
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "exBackend.hpp"
+
+//	region map counters
+typedef struct REGIONMAPSTATS64
+{
+	size_t							mLookups{ 0 };						//	ranges checked
+	size_t							mRejected{ 0 };						//	ranges rejected without touching the target
+	size_t							mQueries{ 0 };						//	regions queried from the backend
+} REGIONMAPSTATS32, regionMapStats_t;
+
+/*
+*	sorted , non overlapping intervals of the target's address space , each marked readable or not
+*	lookups are a binary search , a range that is unknown or older than mMaxAge generations is queried once & stored
+*	unreadable gaps are kept for mMaxGapAge generations , so garbage pointers into them are rejected without a query
+*	a gap is dropped early when a read or write inside it succeeds ( see Forget ) or Refresh finds a mapping in it
+*/
+class exRegionMap
+{
+public:
+	static constexpr i64_t			mMinAddress = 0x10000;											//	the first 64k are never mapped
+	static constexpr i64_t			mMaxAddress = ~i64_t(0) >> (sizeof(i64_t) == 8 ? 17 : 0);		//	top of user space
+	static constexpr unsigned long long	mMaxAge = 64;												//	generations before a readable region is queried again
+	static constexpr unsigned long long	mMaxGapAge = 16;											//	generations before an unreadable gap is queried again
+
+public:
+
+	/* returns true if the whole range lies in readable regions
+	* returns true if the backend cannot answer , the read itself is the final check
+	*/
+	inline bool IsReadable(exMemoryBackend& backend, const i64_t& addr, const size_t& size);
+
+	/* rebuilds the map from every readable region of the target
+	* known gaps are kept unless a readable region now overlaps them , other gaps are left unknown
+	*/
+	inline bool Refresh(exMemoryBackend& backend);
+
+	/* drops the unreadable regions overlapping the range , called after a read or write there succeeded */
+	inline void Forget(const i64_t& addr, const size_t& size);
+
+	/* starts a new generation , regions age by one */
+	inline void NextGeneration();
+
+	/* drops all regions */
+	inline void Clear();
+
+	/* returns a copy of the region map counters */
+	inline regionMapStats_t GetStats();
+
+private:
+	struct SRegion
+	{
+		i64_t						base{ 0 };							//	first address
+		i64_t						end{ 0 };							//	one past the last address
+		bool						bReadable{ false };					//	committed & readable
+		unsigned long long			mGeneration{ 0 };					//	generation the region was queried in
+	};
+
+	/* returns the index of the region containing the address or npos */
+	inline size_t Find(const i64_t& addr) const;
+
+	/* returns true if the region must be queried again , readable regions last mMaxAge generations & gaps mMaxGapAge */
+	inline bool IsStale(const SRegion& region) const { return region.mGeneration + (region.bReadable ? mMaxAge : mMaxGapAge) < mGeneration; }
+
+	/* stores a queried region , replacing any region it overlaps & returns its index */
+	inline size_t Insert(const memRegion_t& region);
+
+	/* updates mGaps after the regions changed */
+	inline void CountGaps();
+
+private:
+	static constexpr size_t			npos = size_t(-1);
+
+	std::mutex						mMutex;
+	std::vector<SRegion>			vmRegions;							//	sorted by base
+	std::vector<memRegion_t>		vmQuery;							//	refresh buffer , reused
+	std::vector<SRegion>			vmGaps;								//	gaps kept by a refresh , reused
+	std::atomic<size_t>				mGaps{ 0 };							//	unreadable regions stored , lets Forget skip the lock when there are none
+	unsigned long long				mGeneration{ 1 };					//	current generation
+	regionMapStats_t				mStats;								//	counters
+};
+
+bool exRegionMap::IsReadable(exMemoryBackend& backend, const i64_t& addr, const size_t& size)
+{
+	if (!size)
+		return true;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	mStats.mLookups++;
+	const i64_t end = addr + size;
+	if (addr < mMinAddress || end <= addr || end - 1 > mMaxAddress)
+	{
+		mStats.mRejected++;
+		return false;
+	}
+
+	i64_t cursor = addr;
+	while (cursor < end)
+	{
+		size_t index = Find(cursor);
+		if (index == npos || IsStale(vmRegions[index]))
+		{
+			memRegion_t region;
+			mStats.mQueries++;
+			if (!backend.QueryRegion(cursor, region) || region.base > cursor || region.base + region.size <= cursor)
+				return true;
+
+			index = Insert(region);
+		}
+
+		const SRegion& region = vmRegions[index];
+		if (!region.bReadable)
+		{
+			mStats.mRejected++;
+			return false;
+		}
+
+		cursor = region.end;
+	}
+
+	return true;
+}
+
+bool exRegionMap::Refresh(exMemoryBackend& backend)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (!backend.QueryRegions(vmQuery))
+		return false;
+
+	mStats.mQueries += vmQuery.size();
+	vmGaps.clear();
+	for (const SRegion& region : vmRegions)
+	{
+		if (!region.bReadable)
+			vmGaps.push_back(region);
+	}
+
+	vmRegions.clear();
+	for (const memRegion_t& region : vmQuery)
+		vmRegions.push_back({ region.base, region.base + region.size, true, mGeneration });
+
+	//	a gap stays known unless a mapping appeared in it
+	for (const SRegion& gap : vmGaps)
+	{
+		auto it = std::upper_bound(vmQuery.begin(), vmQuery.end(), gap.base, [](const i64_t& value, const memRegion_t& region) { return value < region.base + i64_t(region.size); });
+		if (it == vmQuery.end() || it->base >= gap.end)
+			vmRegions.push_back(gap);
+	}
+
+	std::sort(vmRegions.begin(), vmRegions.end(), [](const SRegion& a, const SRegion& b) { return a.base < b.base; });
+	CountGaps();
+
+	return true;
+}
+
+void exRegionMap::Forget(const i64_t& addr, const size_t& size)
+{
+	if (!size || !mGaps.load(std::memory_order_relaxed))
+		return;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	const i64_t end = addr + i64_t(size);
+	auto first = std::upper_bound(vmRegions.begin(), vmRegions.end(), addr, [](const i64_t& value, const SRegion& region) { return value < region.end; });
+	auto last = std::lower_bound(first, vmRegions.end(), end, [](const SRegion& region, const i64_t& value) { return region.base < value; });
+	const auto it = std::remove_if(first, last, [](const SRegion& region) { return !region.bReadable; });
+	if (it == last)
+		return;
+
+	vmRegions.erase(it, last);
+	CountGaps();
+}
+
+void exRegionMap::NextGeneration()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mGeneration++;
+}
+
+void exRegionMap::Clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	vmRegions.clear();
+	mGaps = 0;
+}
+
+regionMapStats_t exRegionMap::GetStats()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mStats;
+}
+
+size_t exRegionMap::Find(const i64_t& addr) const
+{
+	//	first region ending after the address
+	auto it = std::upper_bound(vmRegions.begin(), vmRegions.end(), addr, [](const i64_t& value, const SRegion& region) { return value < region.end; });
+	if (it == vmRegions.end() || it->base > addr)
+		return npos;
+
+	return size_t(it - vmRegions.begin());
+}
+
+size_t exRegionMap::Insert(const memRegion_t& region)
+{
+	const i64_t end = region.base + region.size;
+
+	//	drop every region overlapping the new one
+	auto first = std::upper_bound(vmRegions.begin(), vmRegions.end(), region.base, [](const i64_t& value, const SRegion& r) { return value < r.end; });
+	auto last = std::lower_bound(first, vmRegions.end(), end, [](const SRegion& r, const i64_t& value) { return r.base < value; });
+	first = vmRegions.erase(first, last);
+	first = vmRegions.insert(first, { region.base, end, region.bReadable, mGeneration });
+	const size_t index = size_t(first - vmRegions.begin());
+	CountGaps();
+
+	return index;
+}
+
+void exRegionMap::CountGaps()
+{
+	mGaps.store(size_t(std::count_if(vmRegions.begin(), vmRegions.end(), [](const SRegion& region) { return !region.bReadable; })), std::memory_order_relaxed);
+}
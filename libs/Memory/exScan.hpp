@@ -0,0 +1,282 @@
+//	exMemory signature scanner | vectorized search for byte patterns with wildcards
+
+#pragma once
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define EXMEMORY_SIMD 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define EXMEMORY_AVX2										//	msvc emits avx2 intrinsics without /arch
+#else
+#define EXMEMORY_AVX2 __attribute__((target("avx2")))		//	compiled for avx2 , only called when the cpu has it
+#endif
+#endif
+
+/*
+*	parsed ida style signature , e.g. "48 8B 05 ? ? ? ? 48 85 C0" ( "??" is a wildcard as well )
+*	Find compares two anchor bytes , the rarest fixed bytes of the pattern in x86-64 code , 16 or 32 offsets at a time
+*	only offsets where both anchors match are verified against the whole pattern with a masked compare
+*/
+class exSignature
+{
+public:
+	static constexpr size_t			npos = ~size_t(0);					//	returned by Find when nothing matched
+
+public:
+	explicit inline exSignature(const std::string& signature);
+
+public:
+
+	/* returns false if the signature could not be parsed or has no fixed byte */
+	inline bool IsValid() const { return bValid; }
+
+	/* returns the pattern length in bytes */
+	inline size_t GetSize() const { return vmBytes.size(); }
+
+	/* returns the offset of the first match at or after start , or npos */
+	inline size_t Find(const unsigned char* data, const size_t& size, const size_t& start = 0) const;
+
+private:
+
+	/* returns how common a byte is in x86-64 code , lower is rarer */
+	static inline int GetByteRank(const unsigned char& value);
+
+	/* returns true if the pattern matches at the position , wildcards are masked out */
+	inline bool Verify(const unsigned char* at) const;
+
+	/* scans [start , end) one offset at a time , end is the last offset a match may start at + 1 */
+	inline size_t FindScalar(const unsigned char* data, const size_t& start, const size_t& end) const;
+
+#if defined(EXMEMORY_SIMD)
+	inline size_t FindSSE2(const unsigned char* data, const size_t& start, const size_t& end) const;
+	EXMEMORY_AVX2 inline size_t FindAVX2(const unsigned char* data, const size_t& start, const size_t& end) const;
+
+	/* returns true if the cpu & os support avx2 , checked once */
+	static inline bool HasAVX2();
+#endif
+
+private:
+	std::vector<unsigned char>		vmBytes;							//	pattern bytes , 0 where the mask is 0
+	std::vector<unsigned char>		vmMask;								//	0xFF for fixed bytes , 0 for wildcards
+	size_t							mAnchorA{ 0 };						//	rarest fixed byte
+	size_t							mAnchorB{ 0 };						//	second rarest fixed byte , equals mAnchorA if there is only one
+	bool							bValid{ false };
+};
+
+exSignature::exSignature(const std::string& signature)
+{
+	const char* cursor = signature.c_str();
+	while (*cursor)
+	{
+		if (*cursor == ' ')
+		{
+			cursor++;
+			continue;
+		}
+
+		if (*cursor == '?')
+		{
+			cursor += cursor[1] == '?' ? 2 : 1;
+			vmBytes.push_back(0);
+			vmMask.push_back(0);
+			continue;
+		}
+
+		char* end{ nullptr };
+		const unsigned long value = strtoul(cursor, &end, 16);
+		if (end == cursor || value > 0xFF)
+			return;
+
+		vmBytes.push_back(static_cast<unsigned char>(value));
+		vmMask.push_back(0xFF);
+		cursor = end;
+	}
+
+	//	anchors , the two rarest fixed bytes at different positions
+	bool bFound{ false };
+	for (size_t i = 0; i < vmBytes.size(); i++)
+	{
+		if (!vmMask[i])
+			continue;
+
+		if (!bFound || GetByteRank(vmBytes[i]) < GetByteRank(vmBytes[mAnchorA]))
+			mAnchorA = i;
+
+		bFound = true;
+	}
+
+	mAnchorB = mAnchorA;
+	for (size_t i = 0; i < vmBytes.size(); i++)
+	{
+		if (!vmMask[i] || i == mAnchorA)
+			continue;
+
+		if (mAnchorB == mAnchorA || GetByteRank(vmBytes[i]) < GetByteRank(vmBytes[mAnchorB]))
+			mAnchorB = i;
+	}
+
+	bValid = bFound;
+}
+
+size_t exSignature::Find(const unsigned char* data, const size_t& size, const size_t& start) const
+{
+	if (!bValid || !data || size < vmBytes.size() || start > size - vmBytes.size())
+		return npos;
+
+	const size_t end = size - vmBytes.size() + 1;
+#if defined(EXMEMORY_SIMD)
+	if (HasAVX2())
+		return FindAVX2(data, start, end);
+
+	return FindSSE2(data, start, end);
+#else
+	return FindScalar(data, start, end);
+#endif
+}
+
+int exSignature::GetByteRank(const unsigned char& value)
+{
+	//	rough frequencies in msvc x64 code : padding , rex prefixes , mov / lea / call opcodes & common modrm bytes
+	switch (value)
+	{
+	case 0x00: case 0xCC: case 0xFF: case 0x48:
+		return 4;
+	case 0x8B: case 0x89: case 0x24: case 0x4C: case 0x0F: case 0xE8: case 0x8D: case 0x44:
+		return 3;
+	case 0x85: case 0xC0: case 0x74: case 0x75: case 0x83: case 0x41: case 0x49: case 0x4D: case 0x33: case 0xC3: case 0x01: case 0x10: case 0x20: case 0x08:
+		return 2;
+	default:
+		return 1;
+	}
+}
+
+bool exSignature::Verify(const unsigned char* at) const
+{
+	const size_t size = vmBytes.size();
+	size_t i{ 0 };
+#if defined(EXMEMORY_SIMD)
+	for (; i + 16 <= size; i += 16)
+	{
+		const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at + i));
+		const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vmMask.data() + i));
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(vmBytes.data() + i));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(data, mask), bytes)) != 0xFFFF)
+			return false;
+	}
+#endif
+	for (; i < size; i++)
+	{
+		if ((at[i] & vmMask[i]) != vmBytes[i])
+			return false;
+	}
+
+	return true;
+}
+
+size_t exSignature::FindScalar(const unsigned char* data, const size_t& start, const size_t& end) const
+{
+	const unsigned char a = vmBytes[mAnchorA];
+	const unsigned char b = vmBytes[mAnchorB];
+	for (size_t i = start; i < end; i++)
+	{
+		if (data[i + mAnchorA] == a && data[i + mAnchorB] == b && Verify(data + i))
+			return i;
+	}
+
+	return npos;
+}
+
+#if defined(EXMEMORY_SIMD)
+
+size_t exSignature::FindSSE2(const unsigned char* data, const size_t& start, const size_t& end) const
+{
+	const __m128i a = _mm_set1_epi8(static_cast<char>(vmBytes[mAnchorA]));
+	const __m128i b = _mm_set1_epi8(static_cast<char>(vmBytes[mAnchorB]));
+
+	//	16 candidate offsets per step , anchors are loaded at their offset within the pattern
+	size_t i = start;
+	for (; i + 16 <= end; i += 16)
+	{
+		const __m128i matchA = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + mAnchorA)), a);
+		const __m128i matchB = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + mAnchorB)), b);
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(matchA, matchB)));
+		while (mask)
+		{
+#if defined(_MSC_VER)
+			unsigned long bit;
+			_BitScanForward(&bit, mask);
+#else
+			const unsigned int bit = static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+			if (Verify(data + i + bit))
+				return i + bit;
+
+			mask &= mask - 1;
+		}
+	}
+
+	return FindScalar(data, i, end);
+}
+
+size_t exSignature::FindAVX2(const unsigned char* data, const size_t& start, const size_t& end) const
+{
+	const __m256i a = _mm256_set1_epi8(static_cast<char>(vmBytes[mAnchorA]));
+	const __m256i b = _mm256_set1_epi8(static_cast<char>(vmBytes[mAnchorB]));
+
+	//	32 candidate offsets per step , the tail is left to sse2 & scalar
+	size_t i = start;
+	for (; i + 32 <= end; i += 32)
+	{
+		const __m256i matchA = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + mAnchorA)), a);
+		const __m256i matchB = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + mAnchorB)), b);
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(matchA, matchB)));
+		while (mask)
+		{
+#if defined(_MSC_VER)
+			unsigned long bit;
+			_BitScanForward(&bit, mask);
+#else
+			const unsigned int bit = static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+			if (Verify(data + i + bit))
+				return i + bit;
+
+			mask &= mask - 1;
+		}
+	}
+
+	return FindSSE2(data, i, end);
+}
+
+bool exSignature::HasAVX2()
+{
+	static const bool bResult = []()
+		{
+#if defined(_MSC_VER)
+			int info[4]{};
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+
+			//	os must save ymm registers
+			__cpuid(info, 1);
+			if (!(info[2] & (1 << 27)) || !(info[2] & (1 << 28)) || (_xgetbv(0) & 6) != 6)
+				return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") != 0;
+#endif
+		}();
+
+	return bResult;
+}
+
+#endif
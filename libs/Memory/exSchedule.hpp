@@ -0,0 +1,141 @@
+//	exMemory read scheduler | runs read jobs by priority against a per tick time budget
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+//	read job priority index
+enum class EREADPRIORITY : int
+{
+	PRIORITY_CRITICAL = 0,	//	always runs , ignores the deadline
+	PRIORITY_HIGH,
+	PRIORITY_NORMAL,
+	PRIORITY_LOW,
+	PRIORITY_NULL
+};
+
+//	read scheduler counters
+typedef struct READSCHEDULESTATS64
+{
+	size_t							mTicks{ 0 };						//	calls to Run
+	size_t							mOverruns{ 0 };						//	ticks that ended with jobs carried over
+	size_t							mFinished{ 0 };						//	jobs that completed
+	size_t							mCarried{ 0 };						//	job runs that yielded or were not started before the deadline
+	double							mLastTickMs{ 0 };					//	duration of the last Run
+} READSCHEDULESTATS32, readScheduleStats_t;
+
+/*
+*	a job is a resumable unit of reads , it returns true when finished or false to continue on the next tick
+*	Run executes jobs from the highest priority down , critical jobs always run & the rest only while the budget lasts
+*	jobs that yield or miss the deadline keep their queue position & run again on the next tick
+*	long jobs should check HasTime between steps & yield when it returns false
+*/
+class exReadScheduler
+{
+public:
+	using job_t = std::function<bool(exReadScheduler&)>;
+
+public:
+	explicit inline exReadScheduler(const std::chrono::microseconds& budget = std::chrono::microseconds(8000)) : mBudget(budget) {}
+
+public:
+
+	/* queues a job , jobs submitted while Run is executing start on the next tick */
+	inline void Submit(const EREADPRIORITY& priority, job_t job) { vmQueues[size_t(priority)].push_back(std::move(job)); }
+
+	/* runs queued jobs for one tick
+	* returns the number of jobs that finished
+	*/
+	inline size_t Run();
+
+	/* returns true while the current tick is within its budget , always true for critical jobs */
+	inline bool HasTime() const { return mPriority == EREADPRIORITY::PRIORITY_CRITICAL || clock_t::now() < mDeadline; }
+
+	/* returns true if no jobs are queued */
+	inline bool IsIdle() const;
+
+	/* sets the time budget of a tick */
+	inline void SetBudget(const std::chrono::microseconds& budget) { mBudget = budget; }
+	inline const std::chrono::microseconds& GetBudget() const { return mBudget; }
+
+	/* returns the scheduler counters */
+	inline const readScheduleStats_t& GetStats() const { return mStats; }
+
+private:
+	using clock_t = std::chrono::steady_clock;
+
+	std::array<std::vector<job_t>, size_t(EREADPRIORITY::PRIORITY_NULL)>	vmQueues;	//	queued jobs per priority
+	std::vector<job_t>				vmRunning;							//	jobs of the priority being run , reused
+	std::chrono::microseconds		mBudget;							//	time budget of a tick
+	clock_t::time_point				mDeadline;							//	end of the current tick
+	EREADPRIORITY					mPriority{ EREADPRIORITY::PRIORITY_NULL };	//	priority being run
+	readScheduleStats_t				mStats;								//	counters
+};
+
+size_t exReadScheduler::Run()
+{
+	const auto start = clock_t::now();
+	mDeadline = start + mBudget;
+	mStats.mTicks++;
+
+	size_t result{ 0 };
+	bool bCarried{ false };
+	for (size_t p = 0; p < vmQueues.size(); p++)
+	{
+		mPriority = EREADPRIORITY(p);
+
+		//	take the queue , survivors go back in their original order ahead of anything submitted meanwhile
+		vmRunning.clear();
+		vmRunning.swap(vmQueues[p]);
+		size_t i{ 0 };
+		for (; i < vmRunning.size(); i++)
+		{
+			if (!HasTime())
+				break;
+
+			if (vmRunning[i](*this))
+			{
+				vmRunning[i] = nullptr;
+				mStats.mFinished++;
+				result++;
+				continue;
+			}
+
+			mStats.mCarried++;
+		}
+		mStats.mCarried += vmRunning.size() - i;	//	not started before the deadline
+
+		size_t kept{ 0 };
+		for (size_t j = 0; j < vmRunning.size(); j++)
+		{
+			if (vmRunning[j])
+				vmRunning[kept++] = std::move(vmRunning[j]);
+		}
+		vmRunning.resize(kept);
+		bCarried |= kept > 0;
+
+		for (job_t& job : vmQueues[p])
+			vmRunning.push_back(std::move(job));
+
+		vmQueues[p].swap(vmRunning);
+	}
+	mPriority = EREADPRIORITY::PRIORITY_NULL;
+
+	mStats.mOverruns += bCarried;
+	mStats.mLastTickMs = std::chrono::duration<double, std::milli>(clock_t::now() - start).count();
+
+	return result;
+}
+
+bool exReadScheduler::IsIdle() const
+{
+	for (const auto& queue : vmQueues)
+	{
+		if (!queue.empty())
+			return false;
+	}
+
+	return true;
+}
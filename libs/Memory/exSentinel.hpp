@@ -0,0 +1,54 @@
+//	exMemory sentinels | small remote ranges watched for changes so larger objects are only re-read when they moved
+
+#pragma once
+#include <array>
+#include <cstring>
+#include "exBackend.hpp"
+
+/*
+*	a short range of a remote object ( e.g. a transform or a counter ) that stands in for the whole object
+*	exMemory::CheckSentinels reads many sentinels in one batch & flags those whose bytes changed since the last check
+*	a new range , a failed read or a sentinel older than mMaxAge generations always counts as changed
+*/
+class exSentinel
+{
+	friend class exMemory;
+
+public:
+	static constexpr size_t			szMaxSentinel = 0x40;				//	largest watched range
+	static constexpr unsigned long long	mMaxAge = 32;					//	generations before a change is forced
+
+public:
+	explicit inline exSentinel(const i64_t& addr = 0, const size_t& size = 0) { SetRange(addr, size); }
+
+public:
+
+	/* sets the watched range , a different range marks the sentinel as changed */
+	inline void SetRange(const i64_t& addr, const size_t& size)
+	{
+		const size_t szRange = size < szMaxSentinel ? size : szMaxSentinel;
+		if (addr != mAddr || szRange != mSize)
+			Invalidate();
+
+		mAddr = addr;
+		mSize = szRange;
+	}
+
+	inline const i64_t& GetAddress() const { return mAddr; }
+	inline const size_t& GetSize() const { return mSize; }
+
+	/* returns true if the last check found new bytes , the owner should re-read the object */
+	inline bool IsChanged() const { return bChanged; }
+
+	/* forces the next check to report a change */
+	inline void Invalidate() { bValid = false; bChanged = true; }
+
+private:
+	i64_t							mAddr{ 0 };							//	watched address
+	size_t							mSize{ 0 };							//	watched bytes
+	std::array<unsigned char, szMaxSentinel>	vmData{};				//	bytes of the last check
+	std::array<unsigned char, szMaxSentinel>	vmCheck{};				//	bytes read by the current check
+	unsigned long long				mGeneration{ 0 };					//	generation of the last reported change
+	bool							bValid{ false };					//	vmData holds a successful read
+	bool							bChanged{ true };					//	result of the last check
+};
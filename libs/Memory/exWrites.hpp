@@ -0,0 +1,123 @@
+//	exMemory write batch | staged writes submitted together , sorted & merged by address
+
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "exBackend.hpp"
+
+/*
+*	collects writes with a copy of their bytes so values can be queued from temporaries
+*	Build sorts the writes by address & merges touching or overlapping ones into one request , a later write wins where writes overlap
+*	e.g. exWriteBatch batch; batch.Add<unsigned char>(addrA, 2); batch.Add<unsigned char>(addrB, 5); g_memory.WriteMemoryBatch(batch);
+*/
+class exWriteBatch
+{
+public:
+
+	/* queues size bytes from buffer to be written at addr */
+	inline void Add(const i64_t& addr, const void* buffer, const size_t& size);
+
+	/* queues a value to be written at addr */
+	template<typename T>
+	inline void Add(const i64_t& addr, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "queued writes need trivially copyable types");
+		Add(addr, &value, sizeof(T));
+	}
+
+	/* returns the merged write requests in address order , valid until the next Add , Build or Clear */
+	inline std::span<writeRequest_t> Build();
+
+	/* returns the number of queued writes */
+	inline size_t GetCount() const { return vmWrites.size(); }
+
+	/* returns true if nothing is queued */
+	inline bool IsEmpty() const { return vmWrites.empty(); }
+
+	/* drops every queued write */
+	inline void Clear() { vmWrites.clear(); vmData.clear(); vmRequests.clear(); }
+
+private:
+	struct SWrite
+	{
+		i64_t						addr{ 0 };							//	remote address
+		size_t						offset{ 0 };						//	first byte in vmData
+		size_t						size{ 0 };							//	bytes to write
+		size_t						span{ 0 };							//	merged request the write belongs to
+	};
+
+private:
+	std::vector<SWrite>				vmWrites;							//	writes in queue order
+	std::vector<unsigned char>		vmData;								//	queued bytes
+	std::vector<unsigned char>		vmMerged;							//	bytes of the merged requests
+	std::vector<writeRequest_t>		vmRequests;							//	merged requests
+	std::vector<size_t>				vmOrder;							//	write indices sorted by address , reused
+	std::vector<size_t>				vmOffsets;							//	first byte of each merged request in vmMerged , reused
+};
+
+void exWriteBatch::Add(const i64_t& addr, const void* buffer, const size_t& size)
+{
+	if (!buffer || !size)
+		return;
+
+	const size_t offset = vmData.size();
+	vmData.resize(offset + size);
+	memcpy(vmData.data() + offset, buffer, size);
+	vmWrites.push_back({ addr, offset, size, 0 });
+}
+
+std::span<writeRequest_t> exWriteBatch::Build()
+{
+	vmRequests.clear();
+	if (vmWrites.empty())
+		return {};
+
+	vmOrder.resize(vmWrites.size());
+	for (size_t i = 0; i < vmOrder.size(); i++)
+		vmOrder[i] = i;
+
+	std::stable_sort(vmOrder.begin(), vmOrder.end(), [this](const size_t& a, const size_t& b) { return vmWrites[a].addr < vmWrites[b].addr; });
+
+	//	merged extents , the buffer pointers are set once every size is known
+	vmOffsets.clear();
+	size_t total{ 0 };
+	for (const size_t& index : vmOrder)
+	{
+		SWrite& write = vmWrites[index];
+		const i64_t end = write.addr + i64_t(write.size);
+		if (!vmRequests.empty() && write.addr <= vmRequests.back().addr + i64_t(vmRequests.back().szWrite))
+		{
+			writeRequest_t& last = vmRequests.back();
+			const i64_t lastEnd = last.addr + i64_t(last.szWrite);
+			if (end > lastEnd)
+			{
+				total += size_t(end - lastEnd);
+				last.szWrite = size_t(end - last.addr);
+			}
+		}
+		else
+		{
+			vmOffsets.push_back(total);
+			vmRequests.push_back({ write.addr, nullptr, write.size });
+			total += write.size;
+		}
+
+		write.span = vmRequests.size() - 1;
+	}
+
+	//	copy in queue order so the last write to a byte wins
+	vmMerged.resize(total);
+	for (const SWrite& write : vmWrites)
+	{
+		const writeRequest_t& request = vmRequests[write.span];
+		memcpy(vmMerged.data() + vmOffsets[write.span] + size_t(write.addr - request.addr), vmData.data() + write.offset, write.size);
+	}
+
+	for (size_t i = 0; i < vmRequests.size(); i++)
+		vmRequests[i].buffer = vmMerged.data() + vmOffsets[i];
+
+	return vmRequests;
+}
@@ -237,18 +237,22 @@ namespace UnrealEngine
 
     bool Tools::GetObjectName(const Classes::UObject& object, std::string* out)
     {
+        exReadTag tag("names");
         std::string result;
 
         auto& index = object.UName.ComparisonIndex;
         if (!index)
             return false;
 
-        const auto& names_base = (g_memory.GetProcessInfo().dwModuleBase + UnrealEngine::Offsets::GNames);
+        const i64_t names_base = g_memory.GetAddress(UnrealEngine::Offsets::GNames);
 
         const uint32_t& block = (index >> 16) & 0xFFFF;
         const uint32_t& offset = index & 0xFFFF;
         const uintptr_t block_ptr = names_base + 8 * block + 16;
-        const uintptr_t block_base = g_memory.Read<uintptr_t>(block_ptr);
+        uintptr_t block_base{ 0 };
+        auto mirror = g_memory.GetMirror();
+        if (!mirror || !mirror->Read(block_ptr, &block_base, sizeof(block_base)))   //  block table is mirrored , see TESOblivion()
+            block_base = g_memory.Read<uintptr_t>(block_ptr);
         if (!block_base)
             return false;
 
@@ -261,14 +265,15 @@ namespace UnrealEngine
         const bool is_wide = header & 1;
         const uint16_t len = header >> 6;
 
-        if (len == 0 || len > 127) // 127 because +1 for null-terminator if needed
+        if (len == 0 || len > 1023)   //  FNameEntry length is 10 bits
             return false;
 
-        char buffer[128] = {};
-        if (!g_memory.ReadMemory(entry_ptr + 2, buffer, len))
+        //  wide names are utf-16 & converted to utf-8 , both are read into the per tick string arena
+        const std::string_view name = is_wide ? g_memory.ReadWideString(entry_ptr + 2, len) : g_memory.ReadStringView(entry_ptr + 2, len);
+        if (name.empty())
             return false;
 
-        *out = std::string(buffer, len);
+        out->assign(name);  //  reuses the callers capacity
 
         return true;
     }
@@ -277,83 +282,88 @@ namespace UnrealEngine
     {
         std::string result;
 
-        auto object = g_memory.Read<Classes::UObject>(pObject);
-        auto& index = object.UName.ComparisonIndex;
-        if (!index)
+        const auto object = g_memory.View<Classes::UObject>(pObject);
+        if (!object || !object->UName.ComparisonIndex)
             return false;
 
-		return GetObjectName(object, out);
+		return GetObjectName(*object, out);
     }
 
-    void Tools::SetViewMode(const unsigned __int8& viewMode)
+    bool Tools::GetFString(const FString& string, std::string* out)
     {
-        //  Get World
-        auto pWorld = g_memory.Read<i64_t>(g_memory.GetProcessInfo().dwModuleBase + Offsets::GWorld);
-        if (!pWorld)
-            return;
+        exReadTag tag("strings");
 
-        //  get game instance
-        auto pGameInstance = g_memory.Read<i64_t>(pWorld + Offsets::World::OwningGameInstance);
-        if (!pGameInstance)
-            return;
+        if (!string.data || string.count <= 0 || string.count > string.max || string.count > 0x1000)
+            return false;
 
-        //  get local players
-        auto pLocalPlayers = g_memory.Read<i64_t>(pGameInstance + Offsets::GameInstance::LocalPlayers);
-        if (!pLocalPlayers)
-            return;
+        //  count includes the null terminator
+        std::string_view result = g_memory.ReadWideString(string.data, string.count);
+        while (!result.empty() && result.back() == '\0')
+            result.remove_suffix(1);
 
-        //  get local player
-        auto pLocalPlayer = g_memory.Read<i64_t>(pLocalPlayers);
-        if (!pLocalPlayer)
-            return;
+        if (result.empty())
+            return false;
 
-        //  get local player viewport client
-        auto pViewport = g_memory.Read<i64_t>(pLocalPlayer + Offsets::UPlayer::ViewportClient);
-        if (!pViewport)
-            return;
+        out->assign(result);
 
-        //  finally apply view mode patch
-        g_memory.Write<unsigned __int8>(pViewport + Offsets::ViewportClient::ViewModeIndex, viewMode);
+        return true;
     }
 
-    void Tools::SetMovementMode(const unsigned __int8& movementMode)
+    bool Tools::GetPlayerName(const i64_t& pPlayerState, std::string* out)
     {
-        //  Get World
-        auto pWorld = g_memory.Read<i64_t>(g_memory.GetProcessInfo().dwModuleBase + Offsets::GWorld);
-        if (!pWorld)
-            return;
+        if (!pPlayerState)
+            return false;
 
-        //  get game instance
-        auto pGameInstance = g_memory.Read<i64_t>(pWorld + Offsets::World::OwningGameInstance);
-        if (!pGameInstance)
-            return;
+        const auto name = g_memory.View<FString>(pPlayerState + Offsets::PlayerState::PlayerNamePrivate);
+        if (!name)
+            return false;
 
-        //  get local players
-        auto pLocalPlayers = g_memory.Read<i64_t>(pGameInstance + Offsets::GameInstance::LocalPlayers);
-        if (!pLocalPlayers)
-            return;
+        return GetFString(*name, out);
+    }
 
-        //  get local player
-        auto pLocalPlayer = g_memory.Read<i64_t>(pLocalPlayers);
-        if (!pLocalPlayer)
-            return;
+    void Tools::SetViewMode(const unsigned __int8& viewMode)
+    {
+        exWriteBatch batch;
+        SetViewMode(viewMode, batch);
+        g_memory.WriteMemoryBatch(batch);
+    }
 
-        //  get local player controller
-        auto pLocalController = g_memory.Read<i64_t>(pLocalPlayer + Offsets::UPlayer::PlayerController);
-        if (pLocalController)
-            return;
+    void Tools::SetViewMode(const unsigned __int8& viewMode, exWriteBatch& batch)
+    {
+        exReadTag tag("view mode");
+
+        //  GWorld -> OwningGameInstance -> LocalPlayers[0] -> ViewportClient
+        static exPointerChain chain(0, { Offsets::World::OwningGameInstance, Offsets::GameInstance::LocalPlayers, 0, Offsets::UPlayer::ViewportClient, 0 });
+        chain.SetBase(g_memory.GetAddress(Offsets::GWorld));
 
-        //  get local player character
-        auto pLocalCharacter = g_memory.Read<i64_t>(pLocalController + Offsets::Controller::Character);
-        if (!pLocalCharacter)
+        auto pViewport = g_memory.ResolvePointerChain(chain);
+        if (!pViewport)
             return;
 
-        //  get local player movement component
-        auto pMovementComponent = g_memory.Read<i64_t>(pLocalCharacter + Offsets::Character::CharacterMovement);
+        //  finally queue view mode patch
+        batch.Add<unsigned __int8>(pViewport + Offsets::ViewportClient::ViewModeIndex, viewMode);
+    }
+
+    void Tools::SetMovementMode(const unsigned __int8& movementMode)
+    {
+        exWriteBatch batch;
+        SetMovementMode(movementMode, batch);
+        g_memory.WriteMemoryBatch(batch);
+    }
+
+    void Tools::SetMovementMode(const unsigned __int8& movementMode, exWriteBatch& batch)
+    {
+        exReadTag tag("movement mode");
+
+        //  GWorld -> OwningGameInstance -> LocalPlayers[0] -> PlayerController -> Character -> CharacterMovement
+        static exPointerChain chain(0, { Offsets::World::OwningGameInstance, Offsets::GameInstance::LocalPlayers, 0, Offsets::UPlayer::PlayerController, Offsets::Controller::Character, Offsets::Character::CharacterMovement, 0 });
+        chain.SetBase(g_memory.GetAddress(Offsets::GWorld));
+
+        auto pMovementComponent = g_memory.ResolvePointerChain(chain);
         if (!pMovementComponent)
             return;
 
-        g_memory.Write<unsigned __int8>(pMovementComponent + Offsets::UCharacterMovementComponent::MovementMode, movementMode);
+        batch.Add<unsigned __int8>(pMovementComponent + Offsets::UCharacterMovementComponent::MovementMode, movementMode);
     }
 
     bool Tools::IsValidPosition(const FVector& pos)
@@ -560,7 +570,7 @@ TESOblivion::TESOblivion()
     }
     printf("[+][TESOblivion] attached to process.\n");
 
-    const auto& dwModule = g_memory.GetProcessInfo().dwModuleBase;
+    const i64_t dwModule = g_memory.GetProcessInfo().dwModuleBase;
 
     i64_t gobjects;
     if (g_memory.FindPattern(
@@ -603,6 +613,32 @@ TESOblivion::TESOblivion()
         UnrealEngine::Offsets::GWorld = gworld - dwModule;
         printf("[+][TESOblivion] gworld offset updated.\n");
     }
+
+    //  serve repeated reads within a tick from local page copies , missing pages up to one page apart are fetched together
+    g_memory.SetReadCache(true);
+    g_memory.SetReadCoalescing(true, exPageCache::szPage);
+
+    //  actor layouts rarely move between ticks , the pages read last tick are fetched in one batch before the pointer walk
+    g_memory.SetReadPrefetch(true);
+
+    //  reject stale & garbage pointers locally instead of with a failing read
+    g_memory.SetRegionMap(true);
+
+    //  destroyed actors keep their slot for a while , fail reads of their freed pages locally instead of every tick
+    g_memory.SetNegativeCache(true);
+
+    //  keep the GNames block table & the level's actor array synced in the background , the actor range is set every tick
+    g_memory.SetMirror(true);
+    g_memory.GetMirror()->Register(dwModule + UnrealEngine::Offsets::GNames + 16, 8 * szMirroredNameBlocks);
+    m_actorMirror = g_memory.GetMirror()->Register(0, 0);
+
+    //  syscalls , bytes , failures & latency per exReadTag , shown in the menu
+    g_memory.SetReadMetrics(true);
+
+#ifdef _DEBUG
+    //  log every read , written out on shutdown
+    g_memory.SetReadProfiler(true);
+#endif
 }
 
 TESOblivion::~TESOblivion()
@@ -611,10 +647,20 @@ TESOblivion::~TESOblivion()
 
 void TESOblivion::update()
 {
-    SGlobals globals;
+    //  working state is kept between ticks so its buffers are reused
+    SGlobals& globals = m_tick;
     SGame& game = globals.game;
     SLocalPlayer& localPlayer = globals.localPlayer;
-    std::vector<SImGuiActor> actors;
+
+    //  detach once the game has exited
+    g_memory.update();
+    if (!g_memory.bAttached)
+        return;
+
+    //  new read generation , every page is fetched again on first use
+    g_memory.NextGeneration();
+
+    exReadTag tag("local player");
 
     //  Get World
     game.pWorld = g_memory.Read<i64_t>(g_memory.GetAddress(UnrealEngine::Offsets::GWorld));
@@ -622,83 +668,267 @@ void TESOblivion::update()
         return;
 
     //  Get ULevel , UGameInstance & AGameStateBase
-    game.world = g_memory.Read<UnrealEngine::Classes::UWorld>(game.pWorld);
+    game.world = g_memory.Read<UnrealEngine::Classes::UWorld>(game.pWorld, UnrealEngine::Fields::World);
     if (!game.world.GameState || !game.world.OwningGameInstance || !game.world.PersistentLevel)
         return;
 
     //  Get Local Player , Controller , Pawn & Camera
     game.actors = g_memory.Read<UnrealEngine::TArray<i64_t>>(game.world.PersistentLevel + UnrealEngine::Offsets::Level::Actors);
     game.players = g_memory.Read<UnrealEngine::TArray<i64_t>>(game.world.GameState + UnrealEngine::Offsets::GameState::PlayerArray);
-    i64_t pLocalPlayer = g_memory.Read<i64_t>(game.world.OwningGameInstance + UnrealEngine::Offsets::GameInstance::LocalPlayers);    //  local player array
-    if (!pLocalPlayer)
-        return;
-
-    localPlayer.pULocalPlayer = g_memory.Read<i64_t>(pLocalPlayer);    //  pointer to ULocalPlayer
-    if (!localPlayer.pULocalPlayer)
+    if (auto mirror = g_memory.GetMirror())
+        mirror->SetRange(m_actorMirror, game.actors.data, size_t(std::max(game.actors.count, 0)) * sizeof(i64_t));
+
+    //  UWorld->OwningGameInstance -> LocalPlayers[0] -> PlayerController , cached links are revalidated in one batch
+    m_controllerChain.SetBase(game.pWorld + UnrealEngine::Offsets::World::OwningGameInstance);
+    localPlayer.pPlayerController = g_memory.ResolvePointerChain(m_controllerChain);
+    localPlayer.pULocalPlayer = m_controllerChain.GetLink(2);    //  pointer to ULocalPlayer
+    if (!localPlayer.pULocalPlayer || !localPlayer.pPlayerController)
         return;
 
-    localPlayer.pPlayerController = g_memory.Read<i64_t>(localPlayer.pULocalPlayer + UnrealEngine::Offsets::UPlayer::PlayerController);
-    if (!localPlayer.pPlayerController)
+    //  Get Local Player Components
+    const auto pLocalController = g_memory.View<UnrealEngine::Classes::APlayerController>(localPlayer.pPlayerController, UnrealEngine::Fields::PlayerController);
+    if (!pLocalController)
         return;
 
-    //  Get Local Player Components
-	const auto& pLocalController = g_memory.Read<UnrealEngine::Classes::APlayerController>(localPlayer.pPlayerController);
-    localPlayer.pCameraManager = pLocalController.PlayerCameraManager;
-    localPlayer.pPawn = pLocalController.AcknowledgedPawn;
-    localPlayer.sController = pLocalController;
+    localPlayer.pCameraManager = pLocalController->PlayerCameraManager;
+    localPlayer.pPawn = pLocalController->AcknowledgedPawn;
+    localPlayer.sController = *pLocalController;    //  single copy out of the read buffer
     if (!localPlayer.pPawn || !localPlayer.pCameraManager)
         return;
 
-    //  Get Actors
-	std::unique_ptr<__int64[]> actorsArray = std::make_unique<__int64[]>(game.actors.count);
-    if (!g_memory.ReadMemory(game.actors.data, actorsArray.get(), game.actors.count * sizeof(__int64)))
-        return;
+    //  Get Camera View , read before any actor work so it is never late
+    {
+        exReadTag cameraTag("camera");
+        const auto camera = g_memory.View<UnrealEngine::FCameraCacheEntry>(localPlayer.pCameraManager + UnrealEngine::Offsets::APlayerCameraManager::CameraCachePrivate);
+        globals.CameraView = camera ? *camera : UnrealEngine::FCameraCacheEntry();
+    }
+
+    //  pages the actor walk read last tick are prefetched in one batch ahead of it , after the camera so it never waits on them
+    m_scheduler.Submit(EREADPRIORITY::PRIORITY_HIGH, [](exReadScheduler&) { g_memory.Prefetch(); return true; });
 
-    for (int i = 0; i < game.actors.count; i++)
+    //  Get Actors , the walk runs within the tick budget & resumes next tick where it stopped
+    if (!m_bWalkQueued)
     {
-        auto pActor = actorsArray[i];// g_memory.Read<i64_t>(game.actors.data + (i * 0x8));
-        if (!pActor)
-            continue;
+        m_scheduler.Submit(EREADPRIORITY::PRIORITY_NORMAL, [this](exReadScheduler& scheduler) { return WalkActors(scheduler); });
+        m_bWalkQueued = true;
+    }
+    m_scheduler.Run();
 
-        const auto& character = g_memory.Read<UnrealEngine::Classes::ACharacter>(pActor);
-        const auto& actor = character.APawn.AActor;
-        const auto& object = actor.UObject;
-        if (!actor.RootComponent || !character.Mesh)
-			continue;
-
-        SImGuiActor imActor;
-        const auto& mesh = g_memory.Read<UnrealEngine::Classes::USkeletalMeshComponent>(character.Mesh);
-        const auto& rootComponent = g_memory.Read<UnrealEngine::Classes::USceneComponent>(actor.RootComponent);
-        const auto& boneArray = mesh.USkinnedMeshComponent.BoneArray;
-
-
-        imActor.object = object;    //  object reference
-		imActor.pEntity = pActor;   //  pointer to actor
-        imActor.CTW = (mesh.USkinnedMeshComponent.UMeshComponent.UPrimitiveComponent.USceneComponent.ComponentToWorld); //  world translation component
-        imActor.TM = {
-            (rootComponent.RelativeLocation),
-            (rootComponent.RelativeRotation),
-            (rootComponent.RelativeScale3D),
-            (rootComponent.ComponentVelocity)
-        };
+    //  set globals , render actors stay those of the last complete walk
+    m_imCache = globals;
+}
+
+bool TESOblivion::WalkActors(exReadScheduler& scheduler)
+{
+    SGlobals& globals = m_tick;
+    SGame& game = globals.game;
+    SLocalPlayer& localPlayer = globals.localPlayer;
+    std::vector<SImGuiActor>& actors = m_actorPool;
+    std::vector<readRequest_t>& requests = m_requests;
+    size_t& nActors = m_actorCount;
+    exReadTag tag("actors");
 
-        //  BONES
-        if (boneArray.count > 0 && boneArray.max > 0 && boneArray.max < 500)
+    //  level changed while the walk was carried over , start again
+    if (m_actorCursor && m_actorLevel != game.world.PersistentLevel)
+        m_actorCursor = 0;
+
+    //  new walk , Get Actors ( from the mirror when it is synced , otherwise one read for the whole list )
+    if (!m_actorCursor)
+    {
+        nActors = 0;
+        m_actorLevel = game.world.PersistentLevel;
+
+        auto mirror = g_memory.GetMirror();
+        const size_t count = size_t(std::max(game.actors.count, 0));
+        const bool bChanged = !mirror || !mirror->IsSynced(m_actorMirror) || mirror->GetDirty(m_actorMirror, m_actorDirty) || m_actorList.size() != count;
+        if (bChanged)
         {
-			std::unique_ptr<UnrealEngine::FTransform[]> bones = std::make_unique<UnrealEngine::FTransform[]>(boneArray.max);
-			if (!g_memory.ReadMemory((i64_t)boneArray.data, bones.get(), boneArray.max * sizeof(UnrealEngine::FTransform)))
-				continue;
-
-            std::vector<UnrealEngine::FTransform> boneTransforms; boneTransforms.resize(boneArray.max);
-			for (int i = 0; i < boneArray.max; i++)
-				boneTransforms[i] = bones[i];
-            imActor.bones = boneTransforms;
+            m_actorList.resize(count);
+            if (!count || !mirror || !mirror->Read(game.actors.data, m_actorList.data(), count * sizeof(i64_t)))
+            {
+                if (!count || !g_memory.ReadArray(game.actors.data, m_actorList, count))
+                {
+                    m_bWalkQueued = false;
+                    return true;
+                }
+            }
         }
 
-        if (!UnrealEngine::Tools::GetObjectName(object, &imActor.name))
+        if (m_actorReads.size() < m_actorList.size())
+            m_actorReads.resize(m_actorList.size());
+    }
+
+    while (m_actorCursor < m_actorList.size())
+    {
+        //  out of time , the rest of the list is read next tick
+        if (!scheduler.HasTime())
+            return false;
+
+        const size_t first = m_actorCursor;
+        const size_t last = std::min(m_actorList.size(), first + szActorChunk);
+        m_actorCursor = last;
+
+        //  Get Characters ( single submission for every actor in the chunk , only the members used below are read )
+        requests.clear();
+        for (size_t i = first; i < last; i++)
+        {
+            SActorRead& read = m_actorReads[i];
+            read.pActor = m_actorList[i];
+            if (!read.pActor || !g_memory.IsReadable(read.pActor, sizeof(UnrealEngine::Classes::ACharacter)))
+            {
+                read.pActor = 0;
+                continue;
+            }
+
+            exMemory::PushFieldReads(requests, read.pActor, &read.character, UnrealEngine::Fields::Character);
+        }
+        g_memory.ReadMemoryBatch(requests);
+
+        //  Check Mesh Transforms , one batch of small sentinel reads for the chunk
+        m_sentinels.clear();
+        for (size_t i = first; i < last; i++)
+        {
+            SActorRead& read = m_actorReads[i];
+            const auto& actor = read.character.APawn.AActor;
+            if (!read.pActor || !actor.RootComponent || !read.character.Mesh
+                || !g_memory.IsReadable(read.character.Mesh, sizeof(UnrealEngine::Classes::USkeletalMeshComponent))
+                || !g_memory.IsReadable(actor.RootComponent, sizeof(UnrealEngine::Classes::USceneComponent)))
+            {
+                read.pActor = 0;
+                read.sentinel.Invalidate();
+                continue;
+            }
+
+            //  rotation & translation of the mesh ComponentToWorld , world space so actors attached to a moving parent count as moved
+            //  relative transforms of an attached root do not change while the parent carries it , a new mesh always counts as changed
+            read.sentinel.SetRange(read.character.Mesh + offsetof(UnrealEngine::Classes::USceneComponent, ComponentToWorld),
+                offsetof(UnrealEngine::FTransform, Translation) + sizeof(UnrealEngine::FVector));
+            if (read.pMesh != read.character.Mesh)
+                read.sentinel.Invalidate();
+
+            m_sentinels.push_back(&read.sentinel);
+        }
+        g_memory.CheckSentinels(m_sentinels);
+
+        //  Get Mesh & Root Components , actors that did not move keep the components read on an earlier tick
+        requests.clear();
+        for (size_t i = first; i < last; i++)
+        {
+            SActorRead& read = m_actorReads[i];
+            if (!read.pActor || !read.sentinel.IsChanged())
+                continue;
+
+            read.pMesh = read.character.Mesh;
+            exMemory::PushFieldReads(requests, read.character.Mesh, &read.mesh, UnrealEngine::Fields::SkeletalMesh);
+            exMemory::PushFieldReads(requests, read.character.APawn.AActor.RootComponent, &read.rootComponent, UnrealEngine::Fields::SceneComponent);
+        }
+        g_memory.ReadMemoryBatch(requests);
+
+        //  components that failed to read are read again next tick
+        constexpr size_t nComponentReads = UnrealEngine::Fields::SkeletalMesh.count + UnrealEngine::Fields::SceneComponent.count;
+        for (size_t i = first, r = 0; i < last && r < requests.size(); i++)
+        {
+            SActorRead& read = m_actorReads[i];
+            if (!read.pActor || !read.sentinel.IsChanged())
+                continue;
+
+            for (size_t n = 0; n < nComponentReads; n++)
+            {
+                if (!requests[r + n].bSuccess)
+                    read.sentinel.Invalidate();
+            }
+            r += nComponentReads;
+        }
+
+        //  Build Actors & Get Bones , actors are built in place in the pool so their bone buffers are reused
+        exReadTag boneTag("bones");
+        requests.clear();
+        m_boneOwners.clear();
+        for (size_t i = first; i < last; i++)
+        {
+            const SActorRead& read = m_actorReads[i];
+            if (!read.pActor)
+                continue;
+
+            const auto& actor = read.character.APawn.AActor;
+            const auto& mesh = read.mesh;
+            const auto& rootComponent = read.rootComponent;
+            const auto& boneArray = mesh.USkinnedMeshComponent.BoneArray;
+
+            if (nActors == actors.size())
+                actors.emplace_back();
+
+            SImGuiActor& imActor = actors[nActors++];
+            imActor.object = actor.UObject;    //  object reference
+		    imActor.pEntity = read.pActor;   //  pointer to actor
+            imActor.pPlayerState = read.character.APawn.PlayerState;
+            imActor.CTW = (mesh.USkinnedMeshComponent.UMeshComponent.UPrimitiveComponent.USceneComponent.ComponentToWorld); //  world translation component
+            imActor.TM = {
+                (rootComponent.RelativeLocation),
+                (rootComponent.RelativeRotation),
+                (rootComponent.RelativeScale3D),
+                (rootComponent.ComponentVelocity)
+            };
+
+            //  BONES
+            imActor.bones.clear();
+            if (boneArray.count > 0 && boneArray.max > 0 && boneArray.max < 500)
+            {
+                if (!g_memory.IsReadable(boneArray.data, sizeof(UnrealEngine::FTransform)))
+                {
+                    imActor.pEntity = 0;    //  unreadable bones , same as a failed read
+                    continue;
+                }
+
+                imActor.bones.resize(boneArray.max);
+                requests.push_back({ boneArray.data, imActor.bones.data(), imActor.bones.size() * sizeof(UnrealEngine::FTransform) });
+                m_boneOwners.push_back(nActors - 1);
+            }
+        }
+        g_memory.ReadMemoryBatch(requests);
+
+        //  bone arrays that failed are read again page by page , bones on unreadable pages are zeroed in place so every index keeps its bone
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            const readRequest_t& request = requests[i];
+            if (request.bSuccess)
+                continue;
+
+            SImGuiActor& imActor = actors[m_boneOwners[i]];
+            if (!g_memory.ReadMemoryPartial(request.addr, request.buffer, request.szRead, &m_pageMask))
+            {
+                imActor.pEntity = 0;    //  nothing readable
+                continue;
+            }
+
+            const i64_t firstPage = request.addr / exMemoryBackend::szPage;
+            for (size_t b = 0; b < imActor.bones.size(); b++)
+            {
+                const i64_t boneAddr = request.addr + b * sizeof(UnrealEngine::FTransform);
+                const size_t firstBonePage = size_t(boneAddr / exMemoryBackend::szPage - firstPage);
+                const size_t lastBonePage = size_t((boneAddr + sizeof(UnrealEngine::FTransform) - 1) / exMemoryBackend::szPage - firstPage);
+                if (!m_pageMask[firstBonePage] || !m_pageMask[lastBonePage])
+                    imActor.bones[b] = UnrealEngine::FTransform();  //  see FTransform::IsValid
+            }
+        }
+    }
+
+    //  Get Names & compact the pool , dropped actors are swapped behind the kept ones
+    localPlayer.CTW = UnrealEngine::FTransform();
+    localPlayer.TM = UnrealEngine::EntityTransform();
+    localPlayer.Skeleton.clear();
+    size_t nKept{ 0 };
+    for (size_t i = 0; i < nActors; i++)
+    {
+        SImGuiActor& imActor = actors[i];
+        if (!imActor.pEntity)
+            continue;
+
+        //  players are named by their player state , everything else by its object name
+        if (!UnrealEngine::Tools::GetPlayerName(imActor.pPlayerState, &imActor.name) && !UnrealEngine::Tools::GetObjectName(imActor.object, &imActor.name))
             continue;
         
-        if (pActor == localPlayer.pPawn)
+        if (imActor.pEntity == localPlayer.pPawn)
         {
             localPlayer.CTW = imActor.CTW;
             localPlayer.TM = imActor.TM;
@@ -706,26 +936,37 @@ void TESOblivion::update()
             continue;
         }
 
-        actors.push_back(imActor);
-    }
-    globals.render.actors = actors;
+        if (i != nKept)
+            std::swap(actors[nKept], imActor);
 
-    //  Get Camera View
-    globals.CameraView = g_memory.Read<UnrealEngine::FCameraCacheEntry>(localPlayer.pCameraManager + UnrealEngine::Offsets::APlayerCameraManager::CameraCachePrivate);
+        nKept++;
+    }
+    globals.render.actors.assign(actors.begin(), actors.begin() + nKept);
 
-    //  set globals
-    m_imCache = globals;
+    //  walk complete , the next tick starts a new one
+    m_actorCursor = 0;
+    m_bWalkQueued = false;
+    return true;
 }
 
 void TESOblivion::shutdown()
 {
 
-    //  DISABLE PATCHES
+    //  DISABLE PATCHES , submitted together
+    exWriteBatch patches;
     if (bFlyMode)
-        NoClip(false);
+        NoClip(false, patches);
 
     if (bFullbright)
-        Fullbright(false);
+        Fullbright(false, patches);
+
+    g_memory.WriteMemoryBatch(patches);
+
+    if (auto profiler = g_memory.GetReadProfiler())
+    {
+        profiler->ExportCSV("reads.csv");
+        profiler->ExportJSON("reads.json");
+    }
 
     g_memory.Detach();
 }
@@ -736,20 +977,16 @@ void TESOblivion::shutdown()
 
 i64_t TESOblivion::GetWorld()
 {
-    return g_memory.Read<i64_t>(g_memory.GetProcessInfo().dwModuleBase + UnrealEngine::Offsets::GWorld);
+    return g_memory.Read<i64_t>(g_memory.GetAddress(UnrealEngine::Offsets::GWorld));
 }
 
 i64_t TESOblivion::GetLocalUPlayer(i64_t gWorld)
 {
-    auto pGameInstance = g_memory.Read<i64_t>(gWorld + UnrealEngine::Offsets::World::OwningGameInstance);
-    if (!pGameInstance)
-        return 0;
+    //  UWorld->OwningGameInstance -> LocalPlayers[0]
+    static exPointerChain chain(0, { UnrealEngine::Offsets::GameInstance::LocalPlayers, 0, 0 });
+    chain.SetBase(gWorld + UnrealEngine::Offsets::World::OwningGameInstance);
 
-    auto pLocalPlayers = g_memory.Read<i64_t>(pGameInstance + UnrealEngine::Offsets::GameInstance::LocalPlayers);
-    if (!pLocalPlayers)
-        return 0;
-
-    return g_memory.Read<i64_t>(pLocalPlayers);
+    return g_memory.ResolvePointerChain(chain);
 }
 
 i64_t TESOblivion::GetLocalPlayerController(i64_t uPlayer)
@@ -809,54 +1046,44 @@ bool TESOblivion::GetPlayerRotation(i64_t pPawn, UnrealEngine::FRotator* out)
 
 bool TESOblivion::GetActorArray(i64_t gWorld, std::vector<i64_t>* actors)
 {
-    std::vector<i64_t> _result;
-
     auto pLevel = g_memory.Read<i64_t>(gWorld + UnrealEngine::Offsets::World::PersistentLevel);
     if (!pLevel)
         return false;
 
     UnrealEngine::TArray players = g_memory.Read<UnrealEngine::TArray<i64_t>>(pLevel + UnrealEngine::Offsets::Level::Actors);
-    for (int i = 0; i < players.count; i++)
-    {
-        auto ent = g_memory.Read<i64_t>(players.data + (i * 0x8));
-        if (!ent)
-            continue;
-
-        _result.push_back(ent);
-    }
-
-    if (_result.size() <= 0)
+    actors->clear();
+    if (!players.data || players.count <= 0)
         return false;
 
-    actors->clear();
-    *actors = _result;
+    //  streamed two chunks per batch , null slots of destroyed actors are skipped while copying
+    for (const i64_t& pActor : exRemoteArray<i64_t, 512>(g_memory, players.data, size_t(players.count)))
+    {
+        if (pActor)
+            actors->push_back(pActor);
+    }
 
-    return true;
+    return !actors->empty();
 }
 
 bool TESOblivion::GetPlayerArray(i64_t gWorld, std::vector<i64_t>* actors)
 {
-    std::vector<i64_t> result;
-
     i64_t pGameState = g_memory.Read<i64_t>(gWorld + UnrealEngine::Offsets::World::GameState);
     if (!pGameState)
         return false;
 
     UnrealEngine::TArray players = g_memory.Read<UnrealEngine::TArray<i64_t>>(pGameState + UnrealEngine::Offsets::GameState::PlayerArray);
-    for (int i = 0; i < players.count; i++)
-    {
-        __int32 index = i * 8;
-        auto ent = g_memory.Read<i64_t>(players.data + (i * 0x8));
-        if (!ent)
-            continue;
+    actors->clear();
+    if (!players.data || players.count <= 0)
+        return false;
 
-        result.push_back(ent);
+    //  streamed two chunks per batch , null slots of destroyed actors are skipped while copying
+    for (const i64_t& pActor : exRemoteArray<i64_t, 512>(g_memory, players.data, size_t(players.count)))
+    {
+        if (pActor)
+            actors->push_back(pActor);
     }
 
-    actors->clear();
-    *actors = result;
-
-    return result.size() > 0;
+    return actors->size() > 0;
 }
 
 bool TESOblivion::GetPlayerBonePosByIndex(i64_t pPawn, int index, UnrealEngine::FVector* bone)
@@ -887,4 +1114,8 @@ bool TESOblivion::GetPlayerBonePosByIndex(i64_t pPawn, int index, UnrealEngine::
 
 void TESOblivion::Fullbright(bool bEnable) { UnrealEngine::Tools::SetViewMode(bEnable ? 2 : 5); }
 
-void TESOblivion::NoClip(bool bEnable) { UnrealEngine::Tools::SetMovementMode(bEnable ? 5 : 1); }
\ No newline at end of file
+void TESOblivion::Fullbright(bool bEnable, exWriteBatch& batch) { UnrealEngine::Tools::SetViewMode(bEnable ? 2 : 5, batch); }
+
+void TESOblivion::NoClip(bool bEnable) { UnrealEngine::Tools::SetMovementMode(bEnable ? 5 : 1); }
+
+void TESOblivion::NoClip(bool bEnable, exWriteBatch& batch) { UnrealEngine::Tools::SetMovementMode(bEnable ? 5 : 1, batch); }
\ No newline at end of file
@@ -4,8 +4,26 @@
 #include <Memory/exMemory.hpp>
 #include <Config/config.h>
 
+#if defined(_WIN32)
 #include <d3d9.h>   //  
 #include <d3dx9.h>  //  D3DMatrix
+#else
+//  d3d9 matrix layout , only the type is needed to build the sdk against a non windows target
+typedef struct _D3DMATRIX
+{
+    union
+    {
+        struct
+        {
+            float _11, _12, _13, _14;
+            float _21, _22, _23, _24;
+            float _31, _32, _33, _34;
+            float _41, _42, _43, _44;
+        };
+        float m[4][4];
+    };
+} D3DMATRIX;
+#endif
 
 
 #define sincos(radian, s, c) s = sin(radian); c = cos(radian)
@@ -205,6 +223,9 @@ namespace UnrealEngine
         FVector Scale3D;	//0x0040
         char pad_0058[8];	//0x0058
 
+        //  false for a zeroed transform , e.g. a bone whose page could not be read. a real bone never has a zero scale
+        bool IsValid() const { return Scale3D.X != 0 || Scale3D.Y != 0 || Scale3D.Z != 0; }
+
         //  copy pasta
         D3DMATRIX to_matrix_with_scale();
     };	//Size: 0x0060
@@ -664,13 +685,58 @@ namespace UnrealEngine
         }
     }
 
+    /// 
+    ///     FIELD SETS
+    ///     members read by partial struct reads , see exFields
+    /// 
+    namespace Fields
+    {
+        inline constexpr auto World = exFields<Classes::UWorld>(
+            EX_FIELD(Classes::UWorld, PersistentLevel),
+            EX_FIELD(Classes::UWorld, GameState),
+            EX_FIELD(Classes::UWorld, OwningGameInstance)
+        );
+
+        inline constexpr auto PlayerController = exFields<Classes::APlayerController>(
+            EX_FIELD(Classes::APlayerController, AController.PlayerState),
+            EX_FIELD(Classes::APlayerController, AController.Pawn),
+            EX_FIELD(Classes::APlayerController, AController.ControlRotation),
+            EX_FIELD(Classes::APlayerController, Player),
+            EX_FIELD(Classes::APlayerController, AcknowledgedPawn),
+            EX_FIELD(Classes::APlayerController, PlayerCameraManager)
+        );
+
+        inline constexpr auto Character = exFields<Classes::ACharacter>(
+            EX_FIELD(Classes::ACharacter, APawn.AActor.UObject),
+            EX_FIELD(Classes::ACharacter, APawn.AActor.RootComponent),
+            EX_FIELD(Classes::ACharacter, APawn.PlayerState),
+            EX_FIELD(Classes::ACharacter, Mesh)
+        );
+
+        inline constexpr auto SkeletalMesh = exFields<Classes::USkeletalMeshComponent>(
+            EX_FIELD(Classes::USkeletalMeshComponent, USkinnedMeshComponent.UMeshComponent.UPrimitiveComponent.USceneComponent.ComponentToWorld),
+            EX_FIELD(Classes::USkeletalMeshComponent, USkinnedMeshComponent.BoneArray)
+        );
+
+        inline constexpr auto SceneComponent = exFields<Classes::USceneComponent>(
+            EX_FIELD(Classes::USceneComponent, RelativeLocation),
+            EX_FIELD(Classes::USceneComponent, RelativeRotation),
+            EX_FIELD(Classes::USceneComponent, RelativeScale3D),
+            EX_FIELD(Classes::USceneComponent, ComponentVelocity)
+        );
+    }
+
     namespace Tools
     {
         //  
         bool GetObjectName(const Classes::UObject& object, std::string* outName);
         bool GetObjectName(const i64_t& pObject, std::string* outName);
+        bool GetFString(const FString& string, std::string* out);
+        bool GetPlayerName(const i64_t& pPlayerState, std::string* out);
         void SetViewMode(const unsigned __int8& viewIndex);
+        void SetViewMode(const unsigned __int8& viewIndex, exWriteBatch& batch);
         void SetMovementMode(const unsigned __int8& viewIndex);
+        void SetMovementMode(const unsigned __int8& viewIndex, exWriteBatch& batch);
 
         //  
         bool IsValidPosition(const FVector& pos);
@@ -719,6 +785,7 @@ public:
 
         //	ref
         i64_t pEntity{ 0 };                                       //  entity base address
+        i64_t pPlayerState{ 0 };                                  //  APlayerState* , set for pawns owned by a player
         UnrealEngine::Classes::UObject object;
 	};
 
@@ -744,7 +811,7 @@ public:
         i64_t pCameraManager{ 0 };                            //  APlayerController->PlayerCameraManager
         UnrealEngine::FTransform CTW;                           //  transforms translation
         UnrealEngine::EntityTransform TM;                       //  world transforms { location, rotation, scale, velocity }
-        std::vector<UnrealEngine::FTransform> Skeleton;         //  Skeleton Points
+        std::vector<UnrealEngine::FTransform> Skeleton;         //  Skeleton Points , indexed like the bone array , unreadable bones are zeroed
         UnrealEngine::Classes::APlayerController sController;   //  APlayerController Structure , used for most scatter reads. contains most all player information
 	};
 
@@ -763,8 +830,37 @@ public:	//	patches
     bool bInfiniteAmmo{ false };
     bool bInfiniteConsumablesQ{ false };
 
+private:
+    struct SActorRead
+    {
+        i64_t pActor{ 0 };                                      //  actor address , cleared when the actor is skipped
+        UnrealEngine::Classes::ACharacter character;            //  
+        UnrealEngine::Classes::USkeletalMeshComponent mesh;     //  
+        UnrealEngine::Classes::USceneComponent rootComponent;   //  
+        i64_t pMesh{ 0 };                                       //  mesh the components were read from
+        exSentinel sentinel;                                    //  root transform , components are only read again when it changes
+    };
+
 private:
     SGlobals m_imCache;                                                                           //  cache for imgui thread
+    SGlobals m_tick;                                                                              //  state built by update , reused between ticks
+    std::vector<SActorRead> m_actorReads;                                                         //  per actor read buffers , reused between ticks
+    std::vector<SImGuiActor> m_actorPool;                                                         //  actors built by update , reused between ticks
+    std::vector<i64_t> m_actorList;                                                               //  level actor pointers , reused between ticks
+    std::vector<readRequest_t> m_requests;                                                        //  batch read requests , reused between ticks
+    std::vector<size_t> m_boneOwners;                                                             //  actor index of each bone request , reused between ticks
+    std::vector<bool> m_pageMask;                                                                 //  page validity of partial bone reads , reused between ticks
+    std::vector<exSentinel*> m_sentinels;                                                         //  root transform sentinels of the current chunk , reused between ticks
+    exPointerChain m_controllerChain{ 0, { UnrealEngine::Offsets::GameInstance::LocalPlayers, 0, UnrealEngine::Offsets::UPlayer::PlayerController, 0 } };  //  OwningGameInstance -> LocalPlayers[0] -> PlayerController
+    exReadScheduler m_scheduler{ std::chrono::microseconds(8000) };                               //  runs the actor walk within a per tick budget
+    size_t m_actorCursor{ 0 };                                                                    //  next actor of the walk , carried over between ticks
+    size_t m_actorCount{ 0 };                                                                     //  actors built by the current walk
+    i64_t m_actorLevel{ 0 };                                                                      //  level the current walk started in
+    bool m_bWalkQueued{ false };                                                                  //  the actor walk is queued on the scheduler
+    static constexpr size_t szActorChunk = 128;                                                   //  actors read between two deadline checks
+    size_t m_actorMirror{ 0 };                                                                    //  mirror id of the level's actor array
+    std::vector<mirrorInterval_t> m_actorDirty;                                                   //  changes of the actor array since the last walk , reused
+    static constexpr size_t szMirroredNameBlocks = 0x200;                                         //  GNames block pointers kept in the mirror
 
 public:
 	void update();
@@ -834,11 +930,17 @@ public: //  helpers
 public: //  patches
     /**/
     static void Fullbright(bool bEnable);
+    static void Fullbright(bool bEnable, exWriteBatch& batch);
 
     /**/
     static void NoClip(bool bEnable);
+    static void NoClip(bool bEnable, exWriteBatch& batch);
 
 private:
 
+    /* reads the level actors in chunks until the list is done or the tick budget runs out
+    * returns true once the render actors were rebuilt , false to continue on the next tick
+    */
+    bool WalkActors(exReadScheduler& scheduler);
 };
 inline std::unique_ptr<TESOblivion> g_Oblivion;
\ No newline at end of file
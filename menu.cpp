@@ -92,6 +92,45 @@ void Menu::MainMenu()
         ImGui::SliderFloat("##ESP_DISTANCE", &this->mESPDist, 0.0f, 100.f, "%.0f");
     }
 
+    //  Read Metrics
+    if (ImGui::CollapsingHeader("READS"))
+    {
+        if (ImGui::Button("RESET"))
+            g_memory.ClearReadMetrics();
+
+        const negativeCacheStats_t negative = g_memory.GetNegativeCacheStats();
+        ImGui::SameLine();
+        ImGui::Text("BAD PAGES: %zu | AVOIDED READS: %zu", negative.mPages, negative.mAvoided);
+
+        if (ImGui::BeginTable("##read_metrics", 8, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp))
+        {
+            ImGui::TableSetupColumn("TAG");
+            ImGui::TableSetupColumn("CALLS");
+            ImGui::TableSetupColumn("SYSCALLS");
+            ImGui::TableSetupColumn("KB");
+            ImGui::TableSetupColumn("FAILED");
+            ImGui::TableSetupColumn("TOTAL MS");
+            ImGui::TableSetupColumn("P50 US");
+            ImGui::TableSetupColumn("P99 US");
+            ImGui::TableHeadersRow();
+
+            for (const readMetric_t& metric : g_memory.GetReadMetrics())
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%s", metric.name.c_str());
+                ImGui::TableNextColumn(); ImGui::Text("%zu", metric.mCalls);
+                ImGui::TableNextColumn(); ImGui::Text("%zu", metric.mSyscalls);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", metric.mBytes / 1024.0);
+                ImGui::TableNextColumn(); ImGui::Text("%zu", metric.mFailures);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", metric.mTotalUs / 1000.0);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", metric.mP50Us);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", metric.mP99Us);
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
     ImGui::SetCursorPosY(height - ImGui::GetTextLineHeightWithSpacing() * 2);
     if (ImGui::Button("EXIT", ImGui::GetContentRegionAvail()))
     {
@@ -176,6 +215,9 @@ void Menu::HUD()
 
             for (auto& bone : actor.bones)
             {
+                if (!bone.IsValid())
+                    continue;
+
                 UnrealEngine::FVector2D bone_screen;
                 //  const auto& bone_world = bone.Translation + actor.CTW.Translation;
 				const auto& mx = UnrealEngine::Tools::matrix_multiplication(bone.to_matrix_with_scale(), actor.CTW.to_matrix_with_scale());